@@ -44,6 +44,7 @@
 // Inclusions
 #include <cstdlib>
 #include <iostream>
+#include <string>
 #include <boost/cstdint.hpp>
 
 #ifdef WITH_GMP
@@ -79,6 +80,80 @@ namespace DGtal
   typedef mpz_class BigInteger;
 #endif
 
+#if defined(__SIZEOF_INT128__)
+  #define WITH_INT128
+  ///signed 128-bit integer (compiler extension, stack allocated).
+  __extension__ typedef __int128 int128_t;
+  ///unsigned 128-bit integer (compiler extension, stack allocated).
+  __extension__ typedef unsigned __int128 uint128_t;
+
+  /**
+   * Converts a 128-bit unsigned integer to a string in base 10, since
+   * std::to_string does not provide it.
+   * @param v any 128-bit unsigned integer.
+   * @return the decimal representation of \a v.
+   */
+  inline
+  std::string
+  to_string( uint128_t v )
+  {
+    char buffer[ 40 ];
+    char* ptr = buffer + sizeof( buffer );
+    do { *(--ptr) = char( '0' + int( v % 10 ) ); v /= 10; } while ( v != 0 );
+    return std::string( ptr, buffer + sizeof( buffer ) );
+  }
+
+  /**
+   * Converts a 128-bit signed integer to a string in base 10, since
+   * std::to_string does not provide it.
+   * @param v any 128-bit signed integer.
+   * @return the decimal representation of \a v.
+   */
+  inline
+  std::string
+  to_string( int128_t v )
+  {
+    if ( v < 0 ) return '-' + to_string( uint128_t( 0 ) - uint128_t( v ) );
+    return to_string( uint128_t( v ) );
+  }
+
+  /**
+   * Writes a 128-bit unsigned integer in base 10.
+   *
+   * @note uint128_t is a builtin type, hence argument-dependent
+   * lookup does not find this operator outside namespace DGtal: write
+   * `DGtal::to_string( v )` there, or add `using DGtal::operator<<;`.
+   *
+   * @param out the output stream where the object is written.
+   * @param v any 128-bit unsigned integer.
+   * @return the output stream after the writing.
+   */
+  inline
+  std::ostream&
+  operator<< ( std::ostream & out, uint128_t v )
+  {
+    return out << to_string( v );
+  }
+
+  /**
+   * Writes a 128-bit signed integer in base 10.
+   *
+   * @note int128_t is a builtin type, hence argument-dependent lookup
+   * does not find this operator outside namespace DGtal: write
+   * `DGtal::to_string( v )` there, or add `using DGtal::operator<<;`.
+   *
+   * @param out the output stream where the object is written.
+   * @param v any 128-bit signed integer.
+   * @return the output stream after the writing.
+   */
+  inline
+  std::ostream&
+  operator<< ( std::ostream & out, int128_t v )
+  {
+    return out << to_string( v );
+  }
+#endif
+
 } // namespace DGtal
 
 
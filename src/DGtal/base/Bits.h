@@ -188,8 +188,13 @@ namespace DGtal
 #ifdef TRACE_BITS
       std::cerr << "unsigned int nbSetBits( DGtal::uint64_t val )" << std::endl;
 #endif
+#if defined(__GNUC__) || defined(__clang__)
+      // Single popcount instruction when available.
+      return static_cast<unsigned int>( __builtin_popcountll( val ) );
+#else
       return nbSetBits( static_cast<DGtal::uint32_t>( val & 0xffffffffLL ) ) 
 	+ nbSetBits( static_cast<DGtal::uint32_t>( val >> 32 ) );
+#endif
     }
 
     /**
@@ -330,6 +335,9 @@ namespace DGtal
     static inline 
     unsigned int leastSignificantBit( DGtal::uint64_t n )
     {
+#if defined(__GNUC__) || defined(__clang__)
+      if ( n != 0 ) return static_cast<unsigned int>( __builtin_ctzll( n ) );
+#endif
       return ( n & 0xffffffffLL ) 
         ? leastSignificantBit( (DGtal::uint32_t) n )
         : 32 + leastSignificantBit( (DGtal::uint32_t) (n>>32) );
@@ -73,6 +73,10 @@ namespace DGtal
    * Aim: To provide functions to start and stop a timer. Is useful to get
    * performance of algorithms.
    *
+   * Elapsed times are measured with a monotonic clock (when
+   * available), so that they are not affected by changes of the
+   * system time.
+   *
    * The following code snippet demonstrates how to use \p Clock
    *
    *  \code
@@ -86,6 +86,9 @@ namespace DGtal
    *   A a3( b3 ); // a3.myPtrB smart points to b3.
    * \endcode
    *
+   * When \b smart, it shares the atomic reference count of
+   * CountedPtr, with the same guarantees in multi-threaded code.
+   *
    * @tparam T any data type.
    * @see CountedPtr
    * @see ConstAlias
@@ -337,7 +340,7 @@ namespace DGtal
     bool unique()   const noexcept
     {
       return myIsCountedPtr
-	? ( myAny ? counterPtr()->count == 1 : true )
+	? ( myAny ? counterPtr()->nbReferences() == 1 : true )
 	: true;
     }
 
@@ -350,7 +353,7 @@ namespace DGtal
      */
     unsigned int count() const
     { 
-      return myIsCountedPtr ? counterPtr()->count : 0; 
+      return ( myIsCountedPtr && myAny ) ? counterPtr()->nbReferences() : 0; 
     }
 
     /**
@@ -422,7 +425,7 @@ private:
       // Travis is too slow in Debug mode with this ASSERT.
       ASSERT( myIsCountedPtr );
       myAny = static_cast<void*>( c );
-      if (c) ++c->count;
+      if (c) c->acquire();
     }
 
     /**
@@ -439,7 +442,7 @@ private:
       ASSERT( myIsCountedPtr );
       if (myAny) {
         Counter * counter = counterPtr();
-        if (--counter->count == 0) {
+        if (counter->release()) {
           delete counter->ptr;
           delete counter;
         }
@@ -43,6 +43,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <atomic>
 #include "DGtal/base/Common.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -64,6 +65,14 @@ namespace DGtal
    * to the dynamically allocated object and an integer representing
    * the number of smart pointers currently pointing to this Counter.
    *
+   * The reference count is atomic, hence distinct CountedPtr sharing
+   * the same object may be copied, assigned and destroyed concurrently
+   * by different threads, e.g. to pass objects built by Shortcuts
+   * between the stages of a multi-threaded pipeline. As for
+   * std::shared_ptr, a given CountedPtr object must not be modified by
+   * a thread while another thread accesses it, and the pointed object
+   * itself is not protected.
+   *
    * @code
    * struct A{};
    * CountedPtr<A> smart_p1( new A );
@@ -101,10 +110,33 @@ namespace DGtal
        * counter.
        */
       Counter(T* p = 0, unsigned c = 1) : ptr(p), count(c) {}
+
+      /// Adds a reference to this counter (thread-safe).
+      void acquire() noexcept
+      {
+        count.fetch_add( 1, std::memory_order_relaxed );
+      }
+
+      /**
+       * Removes a reference to this counter (thread-safe).
+       * @return 'true' iff it was the last reference, hence the object
+       * and the counter may be freed.
+       */
+      bool release() noexcept
+      {
+        return count.fetch_sub( 1, std::memory_order_acq_rel ) == 1;
+      }
+
+      /// @return the number of references to this counter.
+      unsigned int nbReferences() const noexcept
+      {
+        return count.load( std::memory_order_acquire );
+      }
+
       /// A pointer to a (shared) dynamically allocated object of type T.
       T*          ptr;
       /// The number of CountedPtr pointing to this counter.
-      unsigned    count;
+      std::atomic<unsigned> count;
     };
 
 
@@ -203,7 +235,7 @@ namespace DGtal
      */
     bool unique()   const noexcept
     {
-      return (myCounter ? myCounter->count == 1 : true);
+      return (myCounter ? myCounter->nbReferences() == 1 : true);
     }
 
     /**
@@ -231,11 +263,12 @@ namespace DGtal
     /**
      * @note For debug.
      *
-     * @return the number of smart pointers pointing to the same object as 'this'.
+     * @return the number of smart pointers pointing to the same
+     * object as 'this', or 0 if 'this' points to nothing.
      */
     unsigned int count() const      
     {
-      return myCounter->count;
+      return myCounter ? myCounter->nbReferences() : 0;
     }
 
     /**
@@ -265,7 +298,7 @@ private:
     void acquire(Counter* c) noexcept
     { // increment the count
         myCounter = c;
-        if (c) ++c->count;
+        if (c) c->acquire();
     }
 
     /**
@@ -278,7 +311,7 @@ private:
     void release()
     { // decrement the count, delete if it is 0
         if (myCounter) {
-            if (--myCounter->count == 0) {
+            if (myCounter->release()) {
                 delete myCounter->ptr;
                 delete myCounter;
             }
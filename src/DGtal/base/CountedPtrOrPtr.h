@@ -87,6 +87,9 @@ namespace DGtal
    * \endcode
    *
    *
+   * When \b smart, it shares the atomic reference count of
+   * CountedPtr, with the same guarantees in multi-threaded code.
+   *
    * @tparam T any data type.
    * @see CountedPtr
    * @see Alias
@@ -300,7 +303,7 @@ namespace DGtal
     bool unique()   const noexcept
     {
       return myIsCountedPtr
-	? ( myAny ? counterPtr()->count == 1 : true )
+	? ( myAny ? counterPtr()->nbReferences() == 1 : true )
 	: true;
     }
     
@@ -313,7 +316,7 @@ namespace DGtal
      */
     unsigned int count() const
     {
-      return myIsCountedPtr ? counterPtr()->count : 0; 
+      return ( myIsCountedPtr && myAny ) ? counterPtr()->nbReferences() : 0; 
     }
 
     /**
@@ -384,7 +387,7 @@ private:
       // Travis is too slow in Debug mode with this ASSERT.
       ASSERT( myIsCountedPtr );
       myAny = static_cast<void*>( c );
-      if (c) ++c->count;
+      if (c) c->acquire();
     }
 
     /**
@@ -401,7 +404,7 @@ private:
       ASSERT( myIsCountedPtr );
       if (myAny) {
         Counter * counter = counterPtr();
-        if (--counter->count == 0) {
+        if (counter->release()) {
           delete counter->ptr;
           delete counter;
         }
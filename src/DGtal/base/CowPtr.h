@@ -61,6 +61,12 @@ namespace DGtal
    * modified. When it is about to be modified, copy it and modify the
    * copy.
    *
+   * Reference counts are those of CountedPtr, hence atomic: distinct
+   * CowPtr sharing the same object may be copied, destroyed and
+   * detached (i.e. copied before a modification) concurrently by
+   * different threads. A thread only modifies an object in place when
+   * its CowPtr is the last one pointing to it.
+   *
    * Taken from http://ootips.org/yonat/4dev/smart-pointers.html
    */
   template <typename T>
@@ -185,6 +191,8 @@ public:
   private:
     void copy()                            // create a new copy of myPtr
     {
+        // unique() synchronizes with the release of the references
+        // dropped by other threads, so modifying in place is safe.
         if (!myPtr.unique()) {
             T* old_p = myPtr.get();
             myPtr = CountedPtr<T>(new T(*old_p));
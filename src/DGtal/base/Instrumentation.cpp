@@ -0,0 +1,395 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file Instrumentation.cpp
+ *
+ * @date 2026/10/18
+ *
+ * Implementation of methods defined in Instrumentation.h
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include "DGtal/base/Instrumentation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+
+///////////////////////////////////////////////////////////////////////////////
+// class Instrumentation
+///////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+  /// An open scope.
+  struct OpenScope
+  {
+    std::string path; ///< the timer name, i.e. the path of scope names
+    double start;     ///< the start time (in ms)
+  };
+
+  /// The data recorded by one thread.
+  struct ThreadData
+  {
+    unsigned int id;                       ///< the index of the thread
+    std::vector<OpenScope> scopes;         ///< the open scopes (only used by its thread)
+    std::mutex mutex;                      ///< protects the data below
+    DGtal::Instrumentation::Timers timers;
+    DGtal::Instrumentation::Counters counters;
+    DGtal::Instrumentation::Events events;
+  };
+
+  /// The data of all threads.
+  struct Registry
+  {
+    std::mutex mutex;                                  ///< protects threads, freeThreads and exited
+    std::vector< std::unique_ptr<ThreadData> > threads; ///< the data of instrumented threads
+    std::vector< ThreadData* > freeThreads;            ///< the data left by exited threads, to be reused
+    ThreadData exited;                                 ///< the merged data of exited threads
+    std::atomic<bool> recordEvents;                    ///< 'true' iff events are recorded
+    std::atomic<long long> origin;                     ///< origin of times (in ns), or 0
+    Registry() : recordEvents( false ), origin( 0 ) {}
+  };
+
+  Registry & registry()
+  {
+    static Registry theRegistry;
+    return theRegistry;
+  }
+
+  /// Gives the data of the current thread back to the registry when
+  /// the thread exits.
+  struct ThreadDataOwner
+  {
+    ThreadData* data;
+    ThreadDataOwner() : data( 0 ) {}
+    ~ThreadDataOwner()
+    {
+      if ( data == 0 ) return;
+      Registry & r = registry();
+      std::lock_guard<std::mutex> lock( r.mutex );
+      {
+        std::lock_guard<std::mutex> dataLock( data->mutex );
+        for ( auto it = data->timers.begin(), itE = data->timers.end(); it != itE; ++it )
+          r.exited.timers[ it->first ].merge( it->second );
+        for ( auto it = data->counters.begin(), itE = data->counters.end(); it != itE; ++it )
+          r.exited.counters[ it->first ] += it->second;
+        r.exited.events.insert( r.exited.events.end(), data->events.begin(), data->events.end() );
+        data->timers.clear();
+        data->counters.clear();
+        data->events.clear();
+      }
+      data->scopes.clear();
+      r.freeThreads.push_back( data );
+    }
+  };
+
+  /// @return the data of the current thread, registered (or reused)
+  /// at first call.
+  ThreadData & threadData()
+  {
+    // The registry is built first, hence destroyed after the owner
+    // of the data of the main thread.
+    Registry & r = registry();
+    static thread_local ThreadDataOwner owner;
+    if ( owner.data == 0 )
+      {
+        std::lock_guard<std::mutex> lock( r.mutex );
+        if ( ! r.freeThreads.empty() )
+          {
+            owner.data = r.freeThreads.back();
+            r.freeThreads.pop_back();
+          }
+        else
+          {
+            r.threads.push_back( std::unique_ptr<ThreadData>( new ThreadData ) );
+            owner.data = r.threads.back().get();
+            owner.data->id = (unsigned int) ( r.threads.size() - 1 );
+          }
+      }
+    return *owner.data;
+  }
+
+  long long clockNanoseconds()
+  {
+    return (long long) std::chrono::duration_cast<std::chrono::nanoseconds>
+      ( std::chrono::steady_clock::now().time_since_epoch() ).count();
+  }
+
+  /// Writes a JSON string.
+  void writeJSONString( std::ostream & out, const std::string & s )
+  {
+    out << '"';
+    for ( std::string::const_iterator it = s.begin(), itE = s.end(); it != itE; ++it )
+      {
+        const unsigned char c = (unsigned char) *it;
+        if ( c == '"' || c == '\\' ) out << '\\' << *it;
+        else if ( c < 0x20 )
+          {
+            char buffer[ 8 ];
+            std::snprintf( buffer, sizeof( buffer ), "\\u%04x", c );
+            out << buffer;
+          }
+        else out << *it;
+      }
+    out << '"';
+  }
+}
+
+std::atomic<bool> DGtal::Instrumentation::myIsEnabled( false );
+
+void
+DGtal::Instrumentation::TimerStatistics::merge( const TimerStatistics & other )
+{
+  if ( other.nbCalls == 0 ) return;
+  min      = nbCalls == 0 ? other.min : std::min( min, other.min );
+  max      = nbCalls == 0 ? other.max : std::max( max, other.max );
+  nbCalls += other.nbCalls;
+  total   += other.total;
+}
+
+void
+DGtal::Instrumentation::enable( bool recordEvents )
+{
+  Registry & r = registry();
+  long long noOrigin = 0;
+  r.origin.compare_exchange_strong( noOrigin, clockNanoseconds() );
+  r.recordEvents.store( recordEvents );
+  myIsEnabled.store( true );
+}
+
+void
+DGtal::Instrumentation::disable()
+{
+  myIsEnabled.store( false );
+}
+
+void
+DGtal::Instrumentation::reset()
+{
+  Registry & r = registry();
+  std::lock_guard<std::mutex> lock( r.mutex );
+  for ( std::size_t i = 0; i < r.threads.size(); ++i )
+    {
+      ThreadData & data = *r.threads[ i ];
+      std::lock_guard<std::mutex> dataLock( data.mutex );
+      data.timers.clear();
+      data.counters.clear();
+      data.events.clear();
+    }
+  r.exited.timers.clear();
+  r.exited.counters.clear();
+  r.exited.events.clear();
+  r.origin.store( clockNanoseconds() );
+}
+
+double
+DGtal::Instrumentation::now()
+{
+  return (double) ( clockNanoseconds() - registry().origin.load() ) * 1e-6;
+}
+
+void
+DGtal::Instrumentation::beginScope( const char* name )
+{
+  ThreadData & data = threadData();
+  OpenScope scope;
+  scope.path  = data.scopes.empty() ? std::string( name )
+    : data.scopes.back().path + "/" + name;
+  data.scopes.push_back( scope );
+  // Measured last, so that the bookkeeping is not timed.
+  data.scopes.back().start = now();
+}
+
+void
+DGtal::Instrumentation::endScope()
+{
+  const double end = now();
+  ThreadData & data = threadData();
+  if ( data.scopes.empty() ) return;
+  const OpenScope & scope = data.scopes.back();
+  TimerStatistics execution;
+  execution.nbCalls = 1;
+  execution.total = execution.min = execution.max = end - scope.start;
+  {
+    std::lock_guard<std::mutex> lock( data.mutex );
+    data.timers[ scope.path ].merge( execution );
+    if ( registry().recordEvents.load( std::memory_order_relaxed ) )
+      {
+        Event event;
+        event.name     = scope.path;
+        event.thread   = data.id;
+        event.start    = scope.start;
+        event.duration = execution.total;
+        data.events.push_back( event );
+      }
+  }
+  data.scopes.pop_back();
+}
+
+void
+DGtal::Instrumentation::count( const std::string & name, DGtal::int64_t value )
+{
+  if ( ! isEnabled() ) return;
+  ThreadData & data = threadData();
+  std::lock_guard<std::mutex> lock( data.mutex );
+  data.counters[ name ] += value;
+}
+
+DGtal::Instrumentation::Timers
+DGtal::Instrumentation::timers()
+{
+  Registry & r = registry();
+  std::lock_guard<std::mutex> lock( r.mutex );
+  Timers result = r.exited.timers;
+  for ( std::size_t i = 0; i < r.threads.size(); ++i )
+    {
+      ThreadData & data = *r.threads[ i ];
+      std::lock_guard<std::mutex> dataLock( data.mutex );
+      for ( Timers::const_iterator it = data.timers.begin(), itE = data.timers.end(); it != itE; ++it )
+        result[ it->first ].merge( it->second );
+    }
+  return result;
+}
+
+DGtal::Instrumentation::Counters
+DGtal::Instrumentation::counters()
+{
+  Registry & r = registry();
+  std::lock_guard<std::mutex> lock( r.mutex );
+  Counters result = r.exited.counters;
+  for ( std::size_t i = 0; i < r.threads.size(); ++i )
+    {
+      ThreadData & data = *r.threads[ i ];
+      std::lock_guard<std::mutex> dataLock( data.mutex );
+      for ( Counters::const_iterator it = data.counters.begin(), itE = data.counters.end(); it != itE; ++it )
+        result[ it->first ] += it->second;
+    }
+  return result;
+}
+
+DGtal::Instrumentation::Events
+DGtal::Instrumentation::events()
+{
+  Events result;
+  Registry & r = registry();
+  {
+    std::lock_guard<std::mutex> lock( r.mutex );
+    result = r.exited.events;
+    for ( std::size_t i = 0; i < r.threads.size(); ++i )
+      {
+        ThreadData & data = *r.threads[ i ];
+        std::lock_guard<std::mutex> dataLock( data.mutex );
+        result.insert( result.end(), data.events.begin(), data.events.end() );
+      }
+  }
+  std::stable_sort( result.begin(), result.end(),
+                    [] ( const Event & e1, const Event & e2 ) { return e1.start < e2.start; } );
+  return result;
+}
+
+void
+DGtal::Instrumentation::report( std::ostream & out )
+{
+  const Timers   allTimers   = timers();
+  const Counters allCounters = counters();
+  const std::ios::fmtflags flags = out.flags();
+  out << "[Instrumentation] timers (ms):" << std::endl
+      << std::setw( 10 ) << "calls" << std::setw( 12 ) << "total"
+      << std::setw( 12 ) << "mean"  << std::setw( 12 ) << "min"
+      << std::setw( 12 ) << "max"   << "  name" << std::endl;
+  out << std::fixed << std::setprecision( 3 );
+  for ( Timers::const_iterator it = allTimers.begin(), itE = allTimers.end(); it != itE; ++it )
+    {
+      const TimerStatistics & stats = it->second;
+      out << std::setw( 10 ) << stats.nbCalls << std::setw( 12 ) << stats.total
+          << std::setw( 12 ) << stats.total / (double) stats.nbCalls
+          << std::setw( 12 ) << stats.min << std::setw( 12 ) << stats.max
+          << "  " << it->first << std::endl;
+    }
+  out << "[Instrumentation] counters:" << std::endl;
+  for ( Counters::const_iterator it = allCounters.begin(), itE = allCounters.end(); it != itE; ++it )
+    out << std::setw( 22 ) << it->second << "  " << it->first << std::endl;
+  out.flags( flags );
+}
+
+void
+DGtal::Instrumentation::exportJSON( std::ostream & out )
+{
+  const Timers   allTimers   = timers();
+  const Counters allCounters = counters();
+  const std::streamsize precision = out.precision( 17 );
+  out << "{\"timers\":[";
+  for ( Timers::const_iterator it = allTimers.begin(), itE = allTimers.end(); it != itE; ++it )
+    {
+      const TimerStatistics & stats = it->second;
+      out << ( it == allTimers.begin() ? "" : "," ) << std::endl << "{\"name\":";
+      writeJSONString( out, it->first );
+      out << ",\"calls\":" << stats.nbCalls << ",\"total_ms\":" << stats.total
+          << ",\"mean_ms\":" << stats.total / (double) stats.nbCalls
+          << ",\"min_ms\":" << stats.min << ",\"max_ms\":" << stats.max << "}";
+    }
+  out << "]," << std::endl << "\"counters\":[";
+  for ( Counters::const_iterator it = allCounters.begin(), itE = allCounters.end(); it != itE; ++it )
+    {
+      out << ( it == allCounters.begin() ? "" : "," ) << std::endl << "{\"name\":";
+      writeJSONString( out, it->first );
+      out << ",\"value\":" << it->second << "}";
+    }
+  out << "]}" << std::endl;
+  out.precision( precision );
+}
+
+void
+DGtal::Instrumentation::exportChromeTrace( std::ostream & out )
+{
+  const Events   allEvents   = events();
+  const Counters allCounters = counters();
+  const std::streamsize precision = out.precision( 17 );
+  // Times are in microseconds in the trace event format.
+  double end = 0.0;
+  out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  bool first = true;
+  for ( Events::const_iterator it = allEvents.begin(), itE = allEvents.end(); it != itE; ++it )
+    {
+      out << ( first ? "" : "," ) << std::endl << "{\"name\":";
+      writeJSONString( out, it->name );
+      out << ",\"cat\":\"DGtal\",\"ph\":\"X\",\"pid\":1,\"tid\":" << it->thread
+          << ",\"ts\":" << it->start * 1000.0 << ",\"dur\":" << it->duration * 1000.0 << "}";
+      end   = std::max( end, it->start + it->duration );
+      first = false;
+    }
+  for ( Counters::const_iterator it = allCounters.begin(), itE = allCounters.end(); it != itE; ++it )
+    {
+      out << ( first ? "" : "," ) << std::endl << "{\"name\":";
+      writeJSONString( out, it->first );
+      out << ",\"cat\":\"DGtal\",\"ph\":\"C\",\"pid\":1,\"ts\":" << end * 1000.0
+          << ",\"args\":{\"value\":" << it->second << "}}";
+      first = false;
+    }
+  out << "]}" << std::endl;
+  out.precision( precision );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
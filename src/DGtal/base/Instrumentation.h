@@ -0,0 +1,273 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file Instrumentation.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module Instrumentation.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(Instrumentation_RECURSES)
+#error Recursive header files inclusion detected in Instrumentation.h
+#else // defined(Instrumentation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define Instrumentation_RECURSES
+
+#if !defined Instrumentation_h
+/** Prevents repeated inclusion of headers. */
+#define Instrumentation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <atomic>
+#include <map>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class Instrumentation
+  /**
+   * Description of class 'Instrumentation' <p> \brief Aim: Collects
+   * timings of named scopes and values of named counters in
+   * (possibly multi-threaded) programs, in order to get per-stage
+   * metrics of production runs without a profiler.
+   *
+   * Instrumentation is disabled by default, and instrumentation
+   * points then cost a single atomic load. Once enabled:
+   *
+   * - a scope is timed by a ScopedTimer (or the macro
+   *   DGTAL_INSTRUMENT_SCOPE) with a monotonic clock. Scopes opened
+   *   while another scope is open in the same thread are nested: their
+   *   timer is named by the path of names from the outermost scope,
+   *   e.g. "VoronoiMap::compute/VoronoiMap::computeOtherSteps". Each
+   *   timer aggregates the number of calls, the total, minimal and
+   *   maximal times.
+   * - a counter (see count() or the macro DGTAL_INSTRUMENT_COUNT) sums
+   *   the values given to it.
+   * - if asked to, each execution of a scope is also recorded as an
+   *   event, which can be exported in the Chrome trace format (open
+   *   the file in chrome://tracing or https://ui.perfetto.dev).
+   *
+   * Each thread records its timings, counters and events on its own
+   * (threads never wait for each other), and the data of all threads
+   * are merged when they are queried or exported. When a thread
+   * exits, its data are merged into those of exited threads and its
+   * storage is reused by the next instrumented thread, so that
+   * programs creating many short-lived threads use a bounded amount of
+   * memory. Reports should be asked once instrumented computations
+   * are over.
+   *
+   * @code
+   * Instrumentation::enable( true ); // also records events
+   * ...  // calls to instrumented DGtal algorithms
+   * {
+   *   DGTAL_INSTRUMENT_SCOPE( "my stage" );
+   *   ...
+   *   DGTAL_INSTRUMENT_COUNT( "my stage/nb points", points.size() );
+   * }
+   * Instrumentation::report( trace.info() );
+   * std::ofstream out( "trace.json" );
+   * Instrumentation::exportChromeTrace( out );
+   * @endcode
+   *
+   * Defining DGTAL_NO_INSTRUMENTATION before including this file
+   * removes the instrumentation points put with the macros.
+   *
+   * @see testInstrumentation.cpp
+   */
+  class Instrumentation
+  {
+    // ----------------------- Public types -----------------------------------
+  public:
+
+    /// The statistics of a timer, i.e. of all the executions of a scope.
+    struct TimerStatistics
+    {
+      std::size_t nbCalls; ///< the number of executions
+      double total;        ///< the total time (in ms)
+      double min;          ///< the minimal time (in ms)
+      double max;          ///< the maximal time (in ms)
+      TimerStatistics() : nbCalls( 0 ), total( 0.0 ), min( 0.0 ), max( 0.0 ) {}
+      /**
+       * Adds an execution or merges statistics.
+       * @param other the statistics of other executions.
+       */
+      void merge( const TimerStatistics & other );
+    };
+
+    /// An execution of a scope.
+    struct Event
+    {
+      std::string name;    ///< the timer name of the scope
+      unsigned int thread; ///< the index of the thread (0 is the first instrumented one, indices of exited threads are reused)
+      double start;        ///< the start time (in ms since enable() or reset())
+      double duration;     ///< the duration (in ms)
+    };
+
+    typedef std::map<std::string, TimerStatistics> Timers;   ///< timers by name
+    typedef std::map<std::string, DGtal::int64_t>  Counters; ///< counters by name
+    typedef std::vector<Event>                     Events;   ///< events
+
+    /**
+     * Times a scope from its construction to its destruction, if
+     * instrumentation is enabled at construction.
+     */
+    class ScopedTimer
+    {
+    public:
+      /**
+       * Constructor. Opens the scope.
+       * @param name the name of the scope, which must be alive as long
+       * as this object (typically a string literal).
+       */
+      explicit ScopedTimer( const char* name )
+        : myIsActive( Instrumentation::isEnabled() )
+      {
+        if ( myIsActive ) Instrumentation::beginScope( name );
+      }
+      /// Destructor. Closes the scope.
+      ~ScopedTimer()
+      {
+        if ( myIsActive ) Instrumentation::endScope();
+      }
+    private:
+      /// 'true' iff the scope has been opened.
+      bool myIsActive;
+      ScopedTimer( const ScopedTimer & other );
+      ScopedTimer & operator=( const ScopedTimer & other );
+    };
+
+    // ----------------------- Static services ------------------------------
+  public:
+
+    /**
+     * Enables instrumentation. The first call sets the origin of
+     * event times.
+     * @param recordEvents when 'true', each execution of a scope is
+     * also recorded as an Event.
+     */
+    static void enable( bool recordEvents = false );
+
+    /// Disables instrumentation. Collected data are kept.
+    static void disable();
+
+    /// @return 'true' iff instrumentation is enabled.
+    static bool isEnabled()
+    {
+      return myIsEnabled.load( std::memory_order_relaxed );
+    }
+
+    /**
+     * Clears all timers, counters and events and resets the origin of
+     * event times. Must not be called while scopes are open.
+     */
+    static void reset();
+
+    /// @return the time (in ms) of a monotonic clock since enable() or reset().
+    static double now();
+
+    /**
+     * Opens a scope in the current thread.
+     * @param name the name of the scope (which must be alive until endScope()).
+     * @see ScopedTimer
+     */
+    static void beginScope( const char* name );
+
+    /**
+     * Closes the last scope opened in the current thread and records
+     * its execution time.
+     */
+    static void endScope();
+
+    /**
+     * Adds a value to a counter (if instrumentation is enabled).
+     * @param name the name of the counter.
+     * @param value the value to add.
+     */
+    static void count( const std::string & name, DGtal::int64_t value = 1 );
+
+    /// @return the timers of all threads, merged.
+    static Timers timers();
+
+    /// @return the counters of all threads, merged.
+    static Counters counters();
+
+    /// @return the events of all threads, sorted by start time.
+    static Events events();
+
+    /**
+     * Writes a human-readable table of timers and counters.
+     * @param out the output stream where the report is written.
+     */
+    static void report( std::ostream & out );
+
+    /**
+     * Exports timers and counters as a JSON object
+     * {"timers":[{"name", "calls", "total_ms", "mean_ms", "min_ms",
+     * "max_ms"}, ...], "counters":[{"name", "value"}, ...]}.
+     * @param out the output stream where the JSON object is written.
+     */
+    static void exportJSON( std::ostream & out );
+
+    /**
+     * Exports events in the Chrome trace event format (complete
+     * events, one track per thread), followed by counters.
+     * @param out the output stream where the JSON trace is written.
+     */
+    static void exportChromeTrace( std::ostream & out );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// 'true' iff instrumentation is enabled.
+    static std::atomic<bool> myIsEnabled;
+
+  }; // end of class Instrumentation
+
+} // namespace DGtal
+
+#ifndef DGTAL_NO_INSTRUMENTATION
+/// Internal macro for unique variable names.
+#define DGTAL_INSTRUMENT_CONCAT2( a, b ) a ## b
+/// Internal macro for unique variable names.
+#define DGTAL_INSTRUMENT_CONCAT( a, b ) DGTAL_INSTRUMENT_CONCAT2( a, b )
+/// Times the end of the current C++ scope under the given name.
+#define DGTAL_INSTRUMENT_SCOPE( name ) \
+  DGtal::Instrumentation::ScopedTimer DGTAL_INSTRUMENT_CONCAT( dgtal_instrument_scope_, __LINE__ )( name )
+/// Adds a value to the given counter.
+#define DGTAL_INSTRUMENT_COUNT( name, value )                           \
+  do { if ( DGtal::Instrumentation::isEnabled() )                       \
+      DGtal::Instrumentation::count( name, (DGtal::int64_t) ( value ) ); } while ( 0 )
+#else
+#define DGTAL_INSTRUMENT_SCOPE( name )
+#define DGTAL_INSTRUMENT_COUNT( name, value ) do {} while ( 0 )
+#endif
+
+#endif // !defined Instrumentation_h
+
+#undef Instrumentation_RECURSES
+#endif // else defined(Instrumentation_RECURSES)
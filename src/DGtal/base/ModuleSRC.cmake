@@ -1,5 +1,6 @@
 
 set(DGTAL_SRC ${DGTAL_SRC} 
     DGtal/base/Bits.cpp
-    DGtal/base/Common.cpp)
+    DGtal/base/Common.cpp
+    DGtal/base/Instrumentation.cpp)
 
@@ -0,0 +1,434 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedFreemanChain.h
+ *
+ * @date 2026/10/18
+ *
+ * @brief Header file for module PackedFreemanChain.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PackedFreemanChain_RECURSES)
+#error Recursive header files inclusion detected in PackedFreemanChain.h
+#else // defined(PackedFreemanChain_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedFreemanChain_RECURSES
+
+#if !defined PackedFreemanChain_h
+/** Prevents repeated inclusion of headers. */
+#define PackedFreemanChain_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedFreemanChain
+  /**
+   * Description of template class 'PackedFreemanChain' <p>
+   * \brief Aim: Describes a digital 4-connected contour like
+   * FreemanChain, i.e. the coordinates of its first point and a
+   * sequence of codes '0', '1', '2', '3' (moves toward +x, +y, -x, -y),
+   * but stores each code on 2 bits only, 32 codes per 64-bit word.
+   *
+   * Long contours (millions of steps) are thus stored four times more
+   * compactly than with FreemanChain, and may be visited, read and
+   * written in a streaming way, without being expanded into a vector
+   * of points:
+   *
+   * - forEachPoint() decodes the codes word by word, by table lookups
+   *   followed by a prefix sum, which the compiler may vectorize;
+   * - the points of the contour are stored every \ref checkpoint_step
+   *   codes, so that the i-th point is computed in constant time by
+   *   counting the codes of each kind in the words that follow the
+   *   last checkpoint (with bit masks and population counts);
+   * - read() and write() use the text format of FreemanChain, without
+   *   building the whole chain code string.
+   *
+   * @code
+   * std::stringstream ss;
+   * ss << "0 0 00001111222233" << std::endl;
+   * PackedFreemanChain<int> c;
+   * PackedFreemanChain<int>::read( ss, c );
+   * Z2i::Point p = c.point( 6 ); // (4,2)
+   * c.forEachPoint( [] ( const Z2i::Point& q ) { std::cout << q << std::endl; } );
+   * @endcode
+   *
+   * @tparam TInteger type of the coordinates of the points.
+   *
+   * @see FreemanChain
+   * @see testPackedFreemanChain.cpp
+   */
+  template <typename TInteger>
+  class PackedFreemanChain
+  {
+  public:
+    BOOST_CONCEPT_ASSERT(( concepts::CInteger<TInteger> ) );
+    typedef TInteger                    Integer;
+    typedef PackedFreemanChain<Integer> Self;
+    typedef PointVector<2, Integer>     Point;
+    typedef PointVector<2, Integer>     Vector;
+    typedef FreemanChain<Integer>       UnpackedChain;
+    typedef DGtal::uint64_t             Word;
+    typedef std::size_t                 Size;
+    typedef std::size_t                 Index;
+
+    /// The number of codes stored in a word.
+    static const Size codes_per_word = 32;
+    /// The number of codes between two stored points (a multiple of
+    /// codes_per_word).
+    static const Size checkpoint_step = 1024;
+
+    /////////////////////////////////////////////////////////////////////////
+    // class PackedFreemanChain::ConstIterator
+    /**
+     * A forward iterator on the points of the contour, from the first
+     * point (position 0) to the last one (position size()). The
+     * past-the-end iterator has position size()+1.
+     */
+    class ConstIterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef Point                     value_type;
+      typedef std::ptrdiff_t            difference_type;
+      typedef const Point*              pointer;
+      typedef const Point&              reference;
+
+      /// Default constructor. The iterator is not valid.
+      ConstIterator() : myChain( nullptr ), myPos( 0 ) {}
+
+      /// Constructor.
+      /// @param chain the visited chain.
+      /// @param pos a position between 0 and `chain.size()+1`.
+      ConstIterator( const Self& chain, Index pos )
+        : myChain( &chain ), myPos( pos ),
+          myXY( pos <= chain.size() ? chain.point( pos ) : chain.lastPoint() )
+      {}
+
+      /// @return the current point.
+      reference operator*() const { return myXY; }
+      /// @return a pointer to the current point.
+      pointer operator->() const { return &myXY; }
+      /// @return the position of the current point.
+      Index position() const { return myPos; }
+
+      /// Pre-increment. Moves to the next point.
+      ConstIterator& operator++()
+      {
+        if ( myPos < myChain->size() )
+          myXY += displacement( myChain->intCode( myPos ) );
+        ++myPos;
+        return *this;
+      }
+
+      /// Post-increment. Moves to the next point.
+      ConstIterator operator++( int )
+      {
+        ConstIterator tmp( *this );
+        ++( *this );
+        return tmp;
+      }
+
+      /// @param other any iterator on the same chain.
+      /// @return 'true' iff both iterators are at the same position.
+      bool operator==( const ConstIterator& other ) const
+      { return myPos == other.myPos; }
+
+      /// @param other any iterator on the same chain.
+      /// @return 'true' iff both iterators are at different positions.
+      bool operator!=( const ConstIterator& other ) const
+      { return myPos != other.myPos; }
+
+    private:
+      /// The visited chain.
+      const Self* myChain;
+      /// The current position.
+      Index myPos;
+      /// The current point.
+      Point myXY;
+    }; // end of class ConstIterator
+
+    // ----------------------- Standard services ------------------------------
+  public:
+    /// @name Standard services (construction, initialization, assignment)
+    /// @{
+
+    /**
+     * Constructor of an empty contour.
+     * @param x the x-coordinate of the first point.
+     * @param y the y-coordinate of the first point.
+     */
+    PackedFreemanChain( Integer x = 0, Integer y = 0 );
+
+    /**
+     * Constructor.
+     * @param s the chain code, a string of '0', '1', '2', '3'.
+     * @param x the x-coordinate of the first point.
+     * @param y the y-coordinate of the first point.
+     */
+    PackedFreemanChain( const std::string& s, Integer x, Integer y );
+
+    /**
+     * Constructor from a Freeman chain.
+     * @param fc any Freeman chain.
+     */
+    PackedFreemanChain( const UnpackedChain& fc );
+
+    /// Copy constructor.
+    /// @param other the object to clone.
+    PackedFreemanChain( const Self& other ) = default;
+
+    /// Assignment.
+    /// @param other the object to copy.
+    /// @return a reference on 'this'.
+    Self& operator=( const Self& other ) = default;
+
+    /**
+     * Empties the contour and sets its first point.
+     * @param x the x-coordinate of the first point.
+     * @param y the y-coordinate of the first point.
+     */
+    void clear( Integer x = 0, Integer y = 0 );
+
+    /**
+     * Appends a move to the contour.
+     * @param code any Freeman code, '0', '1', '2' or '3'.
+     */
+    void push_back( char code );
+
+    /**
+     * Reserves the memory to store the given number of codes.
+     * @param n any number of codes.
+     */
+    void reserve( Size n );
+
+    /// @param other any packed chain.
+    /// @return 'true' iff both chains have the same first point and codes.
+    bool operator==( const Self& other ) const;
+
+    /// @param other any packed chain.
+    /// @return 'true' iff the chains differ.
+    bool operator!=( const Self& other ) const
+    { return ! ( *this == other ); }
+
+    /// @}
+
+    // ----------------------- Accessors ------------------------------
+  public:
+    /// @name Accessors
+    /// @{
+
+    /// @return the number of codes, i.e. the number of points minus one.
+    Size size() const
+    { return mySize; }
+
+    /// @return 'true' iff the contour has no code.
+    bool empty() const
+    { return mySize == 0; }
+
+    /// @param i any position between 0 and size()-1.
+    /// @return the code at position \a i as a char '0', '1', '2' or '3'.
+    char code( Index i ) const
+    { return static_cast<char>( '0' + intCode( i ) ); }
+
+    /// @param i any position between 0 and size()-1.
+    /// @return the code at position \a i as an integer between 0 and 3.
+    unsigned int intCode( Index i ) const
+    {
+      return static_cast<unsigned int>
+        ( ( myWords[ i / codes_per_word ] >> ( 2 * ( i % codes_per_word ) ) ) & 3 );
+    }
+
+    /// @return the first point of the contour.
+    const Point& firstPoint() const
+    { return myFirst; }
+
+    /// @return the last point of the contour.
+    const Point& lastPoint() const
+    { return myLast; }
+
+    /// @return 'true' iff the last point is the first one.
+    bool isClosed() const
+    { return myFirst == myLast; }
+
+    /**
+     * Random access to the points of the contour, in constant time.
+     *
+     * @param i any position between 0 and size().
+     * @return the point of the contour after \a i moves.
+     */
+    Point point( Index i ) const;
+
+    /// @return the number of bytes used to store the codes and the
+    /// checkpoints.
+    Size memoryUsage() const;
+
+    /// @}
+
+    // ----------------------- Enumeration services ------------------------------
+  public:
+    /// @name Enumeration services
+    /// @{
+
+    /// @return an iterator on the first point.
+    ConstIterator begin() const
+    { return ConstIterator( *this, 0 ); }
+
+    /// @return the past-the-end iterator, after the last point.
+    ConstIterator end() const
+    { return ConstIterator( *this, mySize + 1 ); }
+
+    /**
+     * Visits the points of the contour, from the first one to the
+     * last one (size()+1 points), without storing them.
+     *
+     * @tparam PointFunctor the type of any function or functor with
+     * signature `void( const Point& p )`.
+     * @param f the function called on each point.
+     */
+    template <typename PointFunctor>
+    void forEachPoint( PointFunctor f ) const;
+
+    /**
+     * @param[out] pts the size()+1 points of the contour.
+     */
+    void getPoints( std::vector<Point>& pts ) const;
+
+    /**
+     * @return the equivalent (unpacked) Freeman chain.
+     */
+    UnpackedChain unpack() const;
+
+    /// @}
+
+    // ----------------------- Static services ------------------------------
+  public:
+    /// @name Static services
+    /// @{
+
+    /**
+     * Writes a chain in the format of FreemanChain::write, by blocks
+     * of codes.
+     *
+     * @param out any output stream.
+     * @param c any packed chain.
+     */
+    static void write( std::ostream& out, const Self& c );
+
+    /**
+     * Reads a chain written in the format of FreemanChain::write
+     * (lines starting with '#' are skipped). Codes are packed as they
+     * are read.
+     *
+     * @param in any input stream.
+     * @param c (returns) the packed chain.
+     */
+    static void read( std::istream& in, Self& c );
+
+    /**
+     * @param c any code between 0 and 3.
+     * @return the displacement vector of this Freeman code.
+     */
+    static Vector displacement( unsigned int c );
+
+    /**
+     * Computes the displacement of the first codes of a word, in
+     * constant time.
+     *
+     * @param w any word of packed codes.
+     * @param n the number of codes of \a w that are taken into
+     * account (between 0 and codes_per_word).
+     * @return the sum of the displacement vectors of these codes.
+     */
+    static Vector wordDisplacement( Word w, Size n );
+
+    /// @}
+
+    // ----------------------- Interface --------------------------------------
+  public:
+    /// @name Interface
+    /// @{
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /// @}
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// The first point of the contour.
+    Point myFirst;
+    /// The last point of the contour.
+    Point myLast;
+    /// The number of codes.
+    Size mySize;
+    /// The codes, packed 32 per word (the first code in the lowest bits).
+    std::vector<Word> myWords;
+    /// The point before code `k*checkpoint_step`, for each k.
+    std::vector<Point> myCheckpoints;
+
+  }; // end of class PackedFreemanChain
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PackedFreemanChain'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PackedFreemanChain' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TInteger>
+  std::ostream&
+  operator<< ( std::ostream & out, const PackedFreemanChain<TInteger> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/PackedFreemanChain.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedFreemanChain_h
+
+#undef PackedFreemanChain_RECURSES
+#endif // else defined(PackedFreemanChain_RECURSES)
@@ -0,0 +1,353 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ParallelSaturatedSegmentation.h
+ *
+ * @date 2026/10/18
+ *
+ * @brief Header file for module ParallelSaturatedSegmentation.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ParallelSaturatedSegmentation_RECURSES)
+#error Recursive header files inclusion detected in ParallelSaturatedSegmentation.h
+#else // defined(ParallelSaturatedSegmentation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ParallelSaturatedSegmentation_RECURSES
+
+#if !defined ParallelSaturatedSegmentation_h
+/** Prevents repeated inclusion of headers. */
+#define ParallelSaturatedSegmentation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/curves/SegmentComputerUtils.h"
+#include "DGtal/geometry/curves/CDynamicBidirectionalSegmentComputer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ParallelSaturatedSegmentation
+  /**
+   * Description of template class 'ParallelSaturatedSegmentation' <p>
+   * \brief Aim: Computes the saturated segmentation (the whole set of
+   * maximal segments, also called tangential cover) of a range, like
+   * SaturatedSegmentation, but splits the range into chunks whose
+   * maximal segments are computed in parallel (OpenMP).
+   *
+   * It has the same interface (constructor, setSubRange(), setMode()
+   * with the same processing modes, SegmentComputerIterator with
+   * intersectNext() and intersectPrevious()) and visits exactly the
+   * same maximal segments, in the same order, for open (iterators) and
+   * closed (circulators) curves.
+   *
+   * The first and last maximal segments are determined as in
+   * SaturatedSegmentation. Then, the points between their first points
+   * are split into chunks. For each chunk starting at some point \a q,
+   * the first maximal segment starting at or after \a q is computed
+   * from the longest segment starting at \a q: it is either this
+   * segment, if it cannot be extended backward, or the next maximal
+   * segment. Successive maximal segments are then computed as usual
+   * until the next chunk is reached, so that chunks are stitched
+   * exactly.
+   *
+   * Contrary to SaturatedSegmentation, maximal segments are all
+   * computed and stored when the first iterator is requested.
+   *
+   * @code
+   typedef ArithmeticalDSSComputer<ConstIterator,int,4> SegmentComputer;
+   typedef ParallelSaturatedSegmentation<SegmentComputer> Segmentation;
+   Segmentation theSegmentation( curve.begin(), curve.end(), SegmentComputer() );
+   for ( auto it = theSegmentation.begin(), itEnd = theSegmentation.end();
+         it != itEnd; ++it )
+     trace.info() << *it << std::endl;
+   * @endcode
+   *
+   * @tparam TSegmentComputer any model of
+   * concepts::CDynamicBidirectionalSegmentComputer, whose ConstIterator
+   * is a random access iterator or circulator.
+   *
+   * @see SaturatedSegmentation
+   * @see testParallelSaturatedSegmentation.cpp
+   */
+  template <typename TSegmentComputer>
+  class ParallelSaturatedSegmentation
+  {
+  public:
+    BOOST_CONCEPT_ASSERT(( concepts::CDynamicBidirectionalSegmentComputer<TSegmentComputer> ));
+    typedef TSegmentComputer                                 SegmentComputer;
+    typedef typename SegmentComputer::ConstIterator          ConstIterator;
+    typedef ParallelSaturatedSegmentation<TSegmentComputer>  Self;
+    typedef typename IteratorCirculatorTraits<ConstIterator>::Difference Difference;
+    typedef std::size_t                                      Size;
+
+    /////////////////////////////////////////////////////////////////////////
+    // class SegmentComputerIterator
+    /**
+     * Description of class 'ParallelSaturatedSegmentation::SegmentComputerIterator'
+     * <p> \brief Aim: Specific iterator to visit all the maximal
+     * segments of a saturated segmentation.
+     */
+    class SegmentComputerIterator
+    {
+    public:
+      typedef typename Self::SegmentComputer SegmentComputer;
+      typedef typename SegmentComputer::ConstIterator ConstIterator;
+
+      /// Constructor.
+      /// @param aSegmentation the segmentation.
+      /// @param anIndex the index of a maximal segment.
+      SegmentComputerIterator( const Self* aSegmentation, Size anIndex )
+        : myS( aSegmentation ), myIndex( anIndex ) {}
+
+      /// @return 'true' iff the iterator points to a maximal segment.
+      bool isValid() const
+      { return myIndex < myS->mySegments.size(); }
+
+      /// @return a constant reference to the current segment.
+      const SegmentComputer& operator*() const
+      { return myS->mySegments[ myIndex ]; }
+
+      /// @return the current segment.
+      SegmentComputer get() const
+      { return myS->mySegments[ myIndex ]; }
+
+      /// @return a constant pointer to the current segment.
+      const SegmentComputer* operator->() const
+      { return &myS->mySegments[ myIndex ]; }
+
+      /// Pre-increment. Goes to the next maximal segment (in O(1)).
+      SegmentComputerIterator& operator++()
+      {
+        ++myIndex;
+        return *this;
+      }
+
+      /// @param aOther the iterator to compare with.
+      /// @return 'true' iff both iterators point to the same segment.
+      bool operator==( const SegmentComputerIterator& aOther ) const
+      { return ( myS == aOther.myS ) && ( myIndex == aOther.myIndex ); }
+
+      /// @param aOther the iterator to compare with.
+      /// @return 'true' iff the iterators point to different segments.
+      bool operator!=( const SegmentComputerIterator& aOther ) const
+      { return ! ( *this == aOther ); }
+
+      /// @return 'true' if the current segment intersects the next one.
+      bool intersectNext() const
+      { return myS->myIntersectNext[ myIndex ] != 0; }
+
+      /// @return 'true' if the current segment intersects the previous one.
+      bool intersectPrevious() const
+      {
+        return ( myIndex == 0 ) ? myS->myIntersectFirstPrevious
+          : ( myS->myIntersectNext[ myIndex - 1 ] != 0 );
+      }
+
+      /// @return begin iterator on the segment.
+      const ConstIterator begin() const
+      { return myS->mySegments[ myIndex ].begin(); }
+
+      /// @return end iterator on the segment.
+      const ConstIterator end() const
+      { return myS->mySegments[ myIndex ].end(); }
+
+    private:
+      /// The segmentation.
+      const Self* myS;
+      /// The index of the current maximal segment.
+      Size myIndex;
+    }; // end of class SegmentComputerIterator
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param itb begin iterator of the underlying range
+     * @param ite end iterator of the underlying range
+     * @param aSegmentComputer an online segment recognition algorithm.
+     */
+    ParallelSaturatedSegmentation( const ConstIterator& itb,
+                                   const ConstIterator& ite,
+                                   const SegmentComputer& aSegmentComputer );
+
+    /// Copy constructor. Forbidden.
+    ParallelSaturatedSegmentation( const Self& other ) = delete;
+
+    /// Assignment. Forbidden.
+    Self& operator=( const Self& other ) = delete;
+
+    /**
+     * Set a subrange to process (resets the mode to "MostCentered").
+     * @param itb begin iterator the range to processed
+     * @param ite end iterator the range to processed
+     *
+     * Nb: must be a valid range included in the underlying range.
+     */
+    void setSubRange( const ConstIterator& itb, const ConstIterator& ite );
+
+    /**
+     * Set processing mode, see SaturatedSegmentation.
+     * @param aMode one of "First", "MostCentered" (default), "Last",
+     * "First++", "MostCentered++", "Last++".
+     */
+    void setMode( const std::string& aMode );
+
+    /**
+     * Set the minimal number of points of the chunks that are
+     * processed in parallel.
+     * @param aSize any positive number (default is 4096).
+     */
+    void setChunkSize( Size aSize );
+
+    // ----------------------- Iteration services ------------------------------
+  public:
+
+    /**
+     * Computes the maximal segments if they are not already computed.
+     * @return an iterator pointing on the first maximal segment.
+     */
+    SegmentComputerIterator begin() const;
+
+    /**
+     * Computes the maximal segments if they are not already computed.
+     * @return an iterator pointing after the last maximal segment.
+     */
+    SegmentComputerIterator end() const;
+
+    /**
+     * Computes the maximal segments if they are not already computed.
+     * @return the number of maximal segments of the segmentation.
+     */
+    Size size() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// Begin iterator of the underlying range
+    ConstIterator myBegin;
+    /// End iterator of the underlying range
+    ConstIterator myEnd;
+    /// Begin iterator of the subrange to segment
+    ConstIterator myStart;
+    /// End iterator of the subrange to segment
+    ConstIterator myStop;
+    /// Mode, see setMode.
+    std::string myMode;
+    /// The segment computer.
+    SegmentComputer mySegmentComputer;
+    /// The minimal number of points of a chunk.
+    Size myChunkSize;
+
+    /// 'true' iff the maximal segments are computed.
+    mutable bool myIsComputed;
+    /// The maximal segments, in order.
+    mutable std::vector< SegmentComputer > mySegments;
+    /// For each maximal segment, 1 iff it intersects the next one.
+    mutable std::vector< char > myIntersectNext;
+    /// 'true' iff the first maximal segment intersects the previous one.
+    mutable bool myIntersectFirstPrevious;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Computes all the maximal segments.
+    void compute() const;
+
+    /// @param[out] s the first maximal segment of the segmentation.
+    void initFirstMaximalSegment( SegmentComputer& s ) const;
+
+    /// @param[out] s the last maximal segment of the segmentation.
+    void initLastMaximalSegment( SegmentComputer& s ) const;
+
+    /// @param[out] s the first maximal segment starting at or after \a q.
+    /// @param[in] q any point of the range, after its first point.
+    void firstMaximalSegmentFrom( SegmentComputer& s,
+                                  const ConstIterator& q ) const;
+
+    /// @param it the end of a segment.
+    /// @param checkBounds when 'true', returns 'false' if \a it is at
+    /// the bounds of the underlying range (for iterators).
+    /// @return 'true' if the points before and at \a it form a segment.
+    bool doesIntersectNext( const ConstIterator& it, bool checkBounds ) const;
+
+    /// @param it any iterator.
+    /// @return 'true' iff \a it is the begin or end of the underlying range.
+    bool isAtBound( const ConstIterator& it, IteratorType ) const
+    { return ( it == myBegin ) || ( it == myEnd ); }
+
+    /// @return 'false', a circular range has no bound.
+    bool isAtBound( const ConstIterator&, CirculatorType ) const
+    { return false; }
+
+    /// @param a any segment computer.
+    /// @param b any segment computer.
+    /// @return 'true' iff they have the same begin and end iterators.
+    static bool sameRange( const SegmentComputer& a, const SegmentComputer& b )
+    { return ( a.begin() == b.begin() ) && ( a.end() == b.end() ); }
+
+  }; // end of class ParallelSaturatedSegmentation
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ParallelSaturatedSegmentation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ParallelSaturatedSegmentation' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSegmentComputer>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ParallelSaturatedSegmentation<TSegmentComputer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/ParallelSaturatedSegmentation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ParallelSaturatedSegmentation_h
+
+#undef ParallelSaturatedSegmentation_RECURSES
+#endif // else defined(ParallelSaturatedSegmentation_RECURSES)
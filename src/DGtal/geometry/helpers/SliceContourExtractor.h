@@ -0,0 +1,230 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SliceContourExtractor.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module SliceContourExtractor.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SliceContourExtractor_RECURSES)
+#error Recursive header files inclusion detected in SliceContourExtractor.h
+#else // defined(SliceContourExtractor_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SliceContourExtractor_RECURSES
+
+#if !defined SliceContourExtractor_h
+/** Prevents repeated inclusion of headers. */
+#define SliceContourExtractor_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <cstdint>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+#include "DGtal/geometry/curves/PackedFreemanChain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SliceContourExtractor
+  /**
+   * Description of template class 'SliceContourExtractor' <p>
+   * \brief Aim: extracts all the closed boundary contours of all the
+   * 2D slices of a 3D binary shape at once.
+   *
+   * Contrary to Surfaces::track2DSliceBoundary, which tracks one
+   * contour from a given starting surfel, each slice is rasterized
+   * into rows of bits and every boundary component is found by
+   * scanning these rows for the bottom edges of the shape (a
+   * marching-squares style extraction). Slices are independent and
+   * are processed in parallel when OpenMP is available.
+   *
+   * Each slice orthogonal to axis \a k is seen as a 2D image whose
+   * first and second coordinates are the two other axes, taken in
+   * increasing order (see uAxis and vAxis). Each contour is returned
+   * as a PackedFreemanChain of the pointels of the slice: the pointel
+   * with coordinates (x,y) is the lower-left corner of pixel (x,y),
+   * as for FreemanChain::getInterPixelLinels or GridCurve. Contours
+   * are closed, counterclockwise oriented (the shape is on the left),
+   * so that holes are clockwise oriented, and start at the lowest,
+   * then leftmost, bottom edge of their component.
+   *
+   * @code
+   * std::vector< std::vector< SliceContourExtractor<Z3i::KSpace>::Contour > > contours;
+   * SliceContourExtractor<Z3i::KSpace>::extractAllSliceContours( contours, K, 2, aSet );
+   * std::vector< Z2i::Point > pts;
+   * contours[ 10 ][ 0 ].getPoints( pts ); // pointels of the first contour of slice 10
+   * GridCurve< Z2i::KSpace > c; c.initFromPointsRange( pts.begin(), pts.end() );
+   * @endcode
+   *
+   * @tparam TKSpace the type of cellular grid space, a model of
+   * concepts::CCellularGridSpaceND of dimension 3.
+   */
+  template <typename TKSpace>
+  class SliceContourExtractor
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< TKSpace > ));
+    BOOST_STATIC_ASSERT(( TKSpace::dimension == 3 ));
+
+  public:
+    typedef TKSpace                       KSpace;
+    typedef typename KSpace::Integer      Integer;
+    typedef typename KSpace::Point        Point;
+    typedef PackedFreemanChain< Integer > Contour;
+    typedef typename Contour::Point       Point2D;
+    typedef std::vector< Contour >        SliceContours;
+    typedef std::size_t                   Size;
+
+    // ----------------------- Static services ------------------------------
+  public:
+
+    /// @param k an axis.
+    /// @return the axis of the slices orthogonal to \a k giving their first coordinate.
+    static Dimension uAxis( Dimension k );
+
+    /// @param k an axis.
+    /// @return the axis of the slices orthogonal to \a k giving their second coordinate.
+    static Dimension vAxis( Dimension k );
+
+    /**
+       Extracts all the boundary contours of all the slices orthogonal
+       to axis \a k of the shape defined by \a pp within the bounds of
+       \a K. Slices are processed in parallel.
+
+       @tparam PointPredicate a model of concepts::CPointPredicate
+       describing the inside of a digital shape.
+
+       @param[out] contours the contours of each slice, the i-th
+       element being the contours of slice `K.lowerBound()[k] + i`.
+
+       @param K any space of dimension 3.
+
+       @param k the axis orthogonal to the slices.
+
+       @param pp an instance of a model of concepts::CPointPredicate,
+       for instance a SetPredicate for a digital set representing a
+       shape.
+
+       @param interior4 when 'true', pixels of the shape are
+       4-connected along the contours (two pixels of the shape that
+       only share a corner belong to different contours), otherwise
+       they are 8-connected.
+    */
+    template <typename PointPredicate>
+    static
+    void extractAllSliceContours( std::vector< SliceContours > & contours,
+                                  const KSpace & K, Dimension k,
+                                  const PointPredicate & pp,
+                                  bool interior4 = true );
+
+    /**
+       Extracts all the boundary contours of the slice \a x orthogonal
+       to axis \a k of the shape defined by \a pp within the bounds of
+       \a K.
+
+       @tparam PointPredicate a model of concepts::CPointPredicate
+       describing the inside of a digital shape.
+
+       @param[out] contours the contours of the slice, sorted by their
+       first pointel (lowest, then leftmost).
+
+       @param K any space of dimension 3.
+
+       @param k the axis orthogonal to the slice.
+
+       @param x the coordinate of the slice along axis \a k.
+
+       @param pp an instance of a model of concepts::CPointPredicate.
+
+       @param interior4 when 'true', pixels of the shape are
+       4-connected along the contours, otherwise they are 8-connected.
+    */
+    template <typename PointPredicate>
+    static
+    void extractSliceContours( SliceContours & contours,
+                               const KSpace & K, Dimension k, Integer x,
+                               const PointPredicate & pp,
+                               bool interior4 = true );
+
+    // ----------------------- Internals ------------------------------------
+  private:
+    typedef std::uint64_t Word;
+
+    /// The rows of bits of a slice, padded by one empty pixel on
+    /// each side.
+    struct BitSlice
+    {
+      Size width;  ///< the number of pixels per row, padding included.
+      Size height; ///< the number of rows, padding included.
+      Size nbWords;///< the number of words per row.
+      std::vector< Word > bits;
+
+      void init( Size w, Size h );
+      bool get( Size i, Size j ) const
+      { return ( bits[ j * nbWords + ( i >> 6 ) ] >> ( i & 63 ) ) & 1; }
+      void set( Size i, Size j )
+      { bits[ j * nbWords + ( i >> 6 ) ] |= Word( 1 ) << ( i & 63 ); }
+      void reset( Size i, Size j )
+      { bits[ j * nbWords + ( i >> 6 ) ] &= ~( Word( 1 ) << ( i & 63 ) ); }
+    };
+
+    /**
+       Fills \a shape with the pixels of slice \a x orthogonal to \a k.
+    */
+    template <typename PointPredicate>
+    static
+    void rasterize( BitSlice & shape, const KSpace & K, Dimension k,
+                    Integer x, const PointPredicate & pp );
+
+    /**
+       Extracts all the contours of a rasterized slice.
+       @param shape the rows of bits of the slice.
+       @param origin the coordinates of the pixel (0,0) of \a shape.
+       @param[out] contours the extracted contours.
+       @param interior4 the chosen connectedness of the shape.
+    */
+    static
+    void extractContours( const BitSlice & shape, const Point2D & origin,
+                          SliceContours & contours, bool interior4 );
+
+  }; // end of class SliceContourExtractor
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/helpers/SliceContourExtractor.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SliceContourExtractor_h
+
+#undef SliceContourExtractor_RECURSES
+#endif // else defined(SliceContourExtractor_RECURSES)
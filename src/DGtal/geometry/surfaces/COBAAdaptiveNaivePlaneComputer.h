@@ -0,0 +1,502 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file COBAAdaptiveNaivePlaneComputer.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module COBAAdaptiveNaivePlaneComputer.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(COBAAdaptiveNaivePlaneComputer_RECURSES)
+#error Recursive header files inclusion detected in COBAAdaptiveNaivePlaneComputer.h
+#else // defined(COBAAdaptiveNaivePlaneComputer_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define COBAAdaptiveNaivePlaneComputer_RECURSES
+
+#if !defined COBAAdaptiveNaivePlaneComputer_h
+/** Prevents repeated inclusion of headers. */
+#define COBAAdaptiveNaivePlaneComputer_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <set>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CSpace.h"
+#include "DGtal/geometry/surfaces/COBANaivePlaneComputer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class COBAAdaptiveNaivePlaneComputer
+  /**
+   * Description of template class 'COBAAdaptiveNaivePlaneComputer' <p>
+   * \brief Aim: A class that recognizes pieces of digital planes of
+   * given axis width with the COBA algorithm (see
+   * COBANaivePlaneComputer), but which chooses by itself the type of
+   * integer used in internal computations.
+   *
+   * At initialization, the bound \f$ (2 w D^3)^2 \f$ on the
+   * magnitude of internal integers (\a D is the diameter, \a w the
+   * biggest of the width numerator and denominator), times a safety
+   * factor 16 for intermediate sums and cross products, i.e. \f$ 64
+   * w^2 D^6 \f$, is checked against the capacity of \c int64_t,
+   * then of \c int128_t (when the compiler provides it, see
+   * WITH_INT128). Hence \c int64_t is used for \f$ D \le 724 \f$
+   * when \f$ w = 1 \f$ (\f$ D \le 574 \f$ when \f$ w = 2 \f$),
+   * and \c int128_t for \f$ D \le 1176986 \f$ when \f$ w = 1 \f$.
+   * If it fits, all computations are done with machine integers,
+   * which is between 10 and 20 times faster than with GMP. Otherwise,
+   * the object falls back to a COBANaivePlaneComputer with BigInteger
+   * (when DGtal is built with GMP). Hence the user no longer has to
+   * choose between speed and correctness at compile time.
+   *
+   * Points are stored by the underlying COBANaivePlaneComputer (a
+   * sorted std::set, as required by its ForwardContainer interface),
+   * and ranges are given as is to its extend( it, itE ), which
+   * updates the polygon of solutions once for the whole range.
+   *
+   * It is a model of boost::DefaultConstructible,
+   * boost::CopyConstructible, boost::Assignable,
+   * boost::ForwardContainer, concepts::CAdditivePrimitiveComputer,
+   * concepts::CPointPredicate, exactly like COBANaivePlaneComputer.
+   *
+   @code
+   typedef SpaceND<3,int> Z3;
+   typedef COBAAdaptiveNaivePlaneComputer< Z3 > NaivePlaneComputer;
+   NaivePlaneComputer plane;
+   plane.init( 2, 100, 1, 1 );     // axis is z, diameter is 100 => int64_t
+   plane.init( 2, 5000, 1, 1 );    // axis is z, diameter is 5000 => int128_t
+   plane.init( 2, 5000000, 1, 1 ); // axis is z, diameter is 5000000 => BigInteger
+   @endcode
+   *
+   * @tparam TSpace specifies the type of digital space in which lies
+   * input digital points. A model of CSpace.
+   *
+   * @see COBANaivePlaneComputer
+   */
+  template < typename TSpace >
+  class COBAAdaptiveNaivePlaneComputer
+  {
+
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace< TSpace > ));
+    BOOST_STATIC_ASSERT(( TSpace::dimension == 3 ));
+
+    // ----------------------- public types ------------------------------
+  public:
+    typedef TSpace Space;
+    typedef typename Space::Point Point;
+    typedef std::set< Point > PointSet;
+    typedef typename PointSet::size_type Size;
+    typedef typename PointSet::const_iterator ConstIterator;
+    typedef typename PointSet::iterator Iterator;
+    /// The machine integer type used whenever possible.
+    typedef DGtal::int64_t SmallInteger;
+#ifdef WITH_BIGINTEGER
+    /// The integer type used when machine integers may overflow.
+    typedef DGtal::BigInteger LargeInteger;
+#else
+    /// The integer type used when machine integers may overflow
+    /// (without GMP, there is no safer choice).
+    typedef DGtal::int64_t LargeInteger;
+#endif
+#ifdef WITH_INT128
+    /// The wider machine integer type used before falling back to LargeInteger.
+    typedef DGtal::int128_t MediumInteger;
+#else
+    /// Without 128-bit integers, the medium level is never used.
+    typedef LargeInteger MediumInteger;
+#endif
+    // The bounds given in the class documentation hold for these sizes.
+    BOOST_STATIC_ASSERT(( sizeof( SmallInteger ) == 8 ));
+#ifdef WITH_INT128
+    BOOST_STATIC_ASSERT(( sizeof( MediumInteger ) == 16 ));
+#endif
+    typedef COBANaivePlaneComputer< Space, SmallInteger > SmallComputer;
+    typedef COBANaivePlaneComputer< Space, MediumInteger > MediumComputer;
+    typedef COBANaivePlaneComputer< Space, LargeInteger > LargeComputer;
+
+    /// The kind of integers used in internal computations.
+    enum IntegerLevel { SMALL_INTEGER = 0, MEDIUM_INTEGER = 1, LARGE_INTEGER = 2 };
+    typedef typename SmallComputer::Primitive Primitive;
+
+    // ----------------------- std public types ------------------------------
+  public:
+    typedef typename PointSet::const_iterator const_iterator;
+    typedef typename PointSet::const_pointer const_pointer;
+    typedef typename PointSet::const_reference const_reference;
+    typedef typename PointSet::value_type value_type;
+    typedef typename PointSet::difference_type difference_type;
+    typedef typename PointSet::size_type size_type;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~COBAAdaptiveNaivePlaneComputer();
+
+    /**
+     * Constructor. The object is not valid and should be initialized.
+     * @see init
+     */
+    COBAAdaptiveNaivePlaneComputer();
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    COBAAdaptiveNaivePlaneComputer ( const COBAAdaptiveNaivePlaneComputer & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    COBAAdaptiveNaivePlaneComputer & operator= ( const COBAAdaptiveNaivePlaneComputer & other );
+
+    /**
+     * Tells if machine integers are enough for the given parameters.
+     *
+     * @param diameter the diameter for the set of points.
+     * @param widthNumerator the numerator of the maximal axis-width.
+     * @param widthDenominator the denominator of the maximal axis-width.
+     *
+     * @return 'true' iff a COBANaivePlaneComputer with SmallInteger
+     * can be used safely with these parameters.
+     */
+    static bool fitsSmallInteger( DGtal::int64_t diameter,
+                                  DGtal::int64_t widthNumerator = 1,
+                                  DGtal::int64_t widthDenominator = 1 );
+
+    /**
+     * Tells if 128-bit machine integers are enough for the given parameters.
+     *
+     * @param diameter the diameter for the set of points.
+     * @param widthNumerator the numerator of the maximal axis-width.
+     * @param widthDenominator the denominator of the maximal axis-width.
+     *
+     * @return 'true' iff a COBANaivePlaneComputer with MediumInteger
+     * can be used safely with these parameters (always 'false'
+     * without WITH_INT128).
+     */
+    static bool fitsMediumInteger( DGtal::int64_t diameter,
+                                   DGtal::int64_t widthNumerator = 1,
+                                   DGtal::int64_t widthDenominator = 1 );
+
+    /**
+     * @return the kind of integers chosen at initialization.
+     */
+    IntegerLevel integerLevel() const;
+
+    /**
+     * @return 'true' iff the current computations are done with
+     * LargeInteger (i.e. all bound checks failed at initialization).
+     */
+    bool isLarge() const;
+
+    /**
+     * Clear the object, free memory. The plane keeps its main axis,
+     * diameter and width, but contains no point.
+     */
+    void clear();
+
+    /**
+     * All these parameters cannot be changed during the process.
+     * After this call, the object is in a consistent state and can
+     * accept new points for recognition. Calls clear so that the
+     * object is ready to be extended. This is where the type of
+     * internal integers is chosen.
+     *
+     * @param axis the main axis (0,1,2) for x, y or z.
+     *
+     * @param diameter the diameter for the set of points (maximum
+     * distance between the given points)
+     *
+     * @param widthNumerator the maximal axis-width (x,y,or z) for the
+     * plane is defined as the rational number \a widthNumerator / \a
+     * widthDenominator (default is 1/1, i.e. naive plane).
+     *
+     * @param widthDenominator the maximal axis-width (x,y,or z) for
+     * the plane is defined as the rational number \a widthNumerator /
+     * \a widthDenominator (default is 1/1, i.e. naive plane).
+     */
+    void init( Dimension axis, DGtal::int64_t diameter,
+               DGtal::int64_t widthNumerator = 1,
+               DGtal::int64_t widthDenominator = 1 );
+
+    /**
+     * @return the number of vertices/edges of the convex integer polygon of solutions.
+     */
+    Size complexity() const;
+
+    //-------------------- model of ForwardContainer -----------------------------
+  public:
+
+    /**
+     * @return the number of distinct points in the current naive plane.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' if and only if this object contains no point.
+     */
+    bool empty() const;
+
+    /**
+     * @return a const iterator pointing on the first point stored in the current naive plane.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator pointing after the last point stored in the current naive plane.
+     */
+    ConstIterator end() const;
+
+    /**
+     * NB: std version.
+     * @return the maximal allowed number of points in the current naive plane.
+     * @see maxSize
+     */
+    Size max_size() const;
+
+    /**
+     * same as max_size
+     * @return the maximal allowed number of points in the current naive plane.
+     */
+    Size maxSize() const;
+
+    //-------------------- model of concepts::CPointPredicate -----------------------------
+  public:
+
+    /**
+     * Checks if the point \a p is in the current digital plane.
+     *
+     * @param p any 3D point.
+     * @return 'true' if it is in the current plane, false otherwise.
+     */
+    bool operator()( const Point & p ) const;
+
+    //-------------------- model of CIncrementalPrimitiveComputer -----------------------------
+  public:
+
+    /**
+     * Adds the point \a p to this plane if it is within the current
+     * bounds. The plane parameters are not updated.
+     *
+     * @param p any 3D point (in the specified diameter).
+     * @return 'true' if \a p is in the plane, 'false' otherwise (the
+     * object is then in its original state).
+     */
+    bool extendAsIs( const Point & p );
+
+    /**
+     * Adds the point \a p and checks if we have still a digital plane
+     * of specified width. The plane parameters may be updated so as
+     * to include the new point.
+     *
+     * @param p any 3D point (in the specified diameter).
+     * @return 'true' if it is still a plane, 'false' otherwise (the
+     * object is then in its original state).
+     */
+    bool extend( const Point & p );
+
+    /**
+     * Checks if we have still a digital plane of specified width when
+     * adding point \a p. The object is left unchanged whatever the
+     * returned value.
+     *
+     * @param p any 3D point (in the specified diameter).
+     * @return 'true' if this is still a plane, 'false' otherwise.
+     */
+    bool isExtendable( const Point & p ) const;
+
+    //-------------------- model of CAdditivePrimitiveComputer -----------------------------
+  public:
+
+    /**
+     * Adds the range of points [\a it, \a itE) and checks if we have
+     * still a digital plane of specified width. The whole range is
+     * processed at once, so that the polygon of solutions is cut only
+     * when the range as a whole does not fit the current plane.
+     *
+     * @tparam TInputIterator any model of ForwardIterator on Point.
+     * @param it an iterator on the first element of the range of 3D points.
+     * @param itE an iterator after the last element of the range of 3D points.
+     *
+     * @return 'true' if it is still a plane, 'false' otherwise (the
+     * object is then in its original state).
+     */
+    template <typename TInputIterator>
+    bool extend( TInputIterator it, TInputIterator itE );
+
+    /**
+     * Checks if we have still a digital plane of specified width when
+     * adding the range of points [\a it, \a itE). The object is left
+     * unchanged whatever the returned value.
+     *
+     * @tparam TInputIterator any model of ForwardIterator on Point.
+     * @param it an iterator on the first element of the range of 3D points.
+     * @param itE an iterator after the last element of the range of 3D points.
+     *
+     * @return 'true' if this is still a plane, 'false' otherwise.
+     */
+    template <typename TInputIterator>
+    bool isExtendable( TInputIterator it, TInputIterator itE ) const;
+
+    //-------------------- Primitive services -----------------------------
+  public:
+
+    /**
+       @return the current primitive recognized by this computer,
+       which is a ParallelStrip of axis width smaller than the one
+       specified at instanciation.
+    */
+    Primitive primitive() const;
+
+    //-------------------- Parameters services -----------------------------
+  public:
+
+    /**
+     * @tparam Vector3D any type T such that T.operator[](int i)
+     * returns a reference to a double. i ranges in 0,1,2.
+     *
+     * @param [in,out] normal  the current normal vector
+     */
+    template <typename Vector3D>
+    void getNormal( Vector3D & normal ) const;
+
+    /**
+     * @tparam Vector3D any type T such that T.operator[](int i)
+     * returns a reference to a double. i ranges in 0,1,2.
+     *
+     * @param [in,out] normal (updates) the current unit normal vector
+     */
+    template <typename Vector3D>
+    void getUnitNormal( Vector3D & normal ) const;
+
+    /**
+     * If n is the unit normal to the current plane, then n.x >= min
+     * and n.x <= max are the two half-planes defining it.
+     *
+     * @param min the lower bound (corresponding to the unit vector).
+     * @param max the upper bound (corresponding to the unit vector).
+     */
+    void getBounds( double & min, double & max ) const;
+
+    /**
+     * @pre ! empty()
+     * @return the current minimal point of the plane.
+     */
+    const Point & minimalPoint() const;
+
+    /**
+     * @pre ! empty()
+     * @return the current maximal point of the plane.
+     */
+    const Point & maximalPoint() const;
+
+    /**
+     * @return a const reference to the computer working with machine
+     * integers (only meaningful when `! isLarge()`).
+     */
+    const SmallComputer & smallComputer() const;
+
+    /**
+     * @return a const reference to the computer working with 128-bit
+     * integers (only meaningful when `integerLevel() == MEDIUM_INTEGER`).
+     */
+    const MediumComputer & mediumComputer() const;
+
+    /**
+     * @return a const reference to the computer working with big
+     * integers (only meaningful when `isLarge()`).
+     */
+    const LargeComputer & largeComputer() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    IntegerLevel myLevel;            /**< The kind of integers currently used. */
+    SmallComputer mySmallComputer;   /**< The COBA computer with 64-bit integers. */
+    MediumComputer myMediumComputer; /**< The COBA computer with 128-bit integers. */
+    LargeComputer myLargeComputer;   /**< The COBA computer with big integers. */
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param diameter the diameter for the set of points.
+     * @param widthNumerator the numerator of the maximal axis-width.
+     * @param widthDenominator the denominator of the maximal axis-width.
+     *
+     * @return an upper bound on the magnitude of internal integers,
+     * safety margin included.
+     */
+    static long double magnitude( DGtal::int64_t diameter,
+                                  DGtal::int64_t widthNumerator,
+                                  DGtal::int64_t widthDenominator );
+
+  }; // end of class COBAAdaptiveNaivePlaneComputer
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'COBAAdaptiveNaivePlaneComputer'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'COBAAdaptiveNaivePlaneComputer' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const COBAAdaptiveNaivePlaneComputer<TSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/COBAAdaptiveNaivePlaneComputer.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined COBAAdaptiveNaivePlaneComputer_h
+
+#undef COBAAdaptiveNaivePlaneComputer_RECURSES
+#endif // else defined(COBAAdaptiveNaivePlaneComputer_RECURSES)
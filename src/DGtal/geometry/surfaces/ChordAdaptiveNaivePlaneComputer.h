@@ -0,0 +1,566 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ChordAdaptiveNaivePlaneComputer.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module ChordAdaptiveNaivePlaneComputer.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ChordAdaptiveNaivePlaneComputer_RECURSES)
+#error Recursive header files inclusion detected in ChordAdaptiveNaivePlaneComputer.h
+#else // defined(ChordAdaptiveNaivePlaneComputer_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ChordAdaptiveNaivePlaneComputer_RECURSES
+
+#if !defined ChordAdaptiveNaivePlaneComputer_h
+/** Prevents repeated inclusion of headers. */
+#define ChordAdaptiveNaivePlaneComputer_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <set>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CSpace.h"
+#include "DGtal/geometry/surfaces/ChordNaivePlaneComputer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ChordAdaptiveNaivePlaneComputer
+  /**
+   * Description of template class 'ChordAdaptiveNaivePlaneComputer' <p>
+   * \brief Aim: A class that recognizes pieces of digital planes of
+   * given axis width with the chord algorithm (see
+   * ChordNaivePlaneComputer), but which chooses by itself the type of
+   * scalar used in internal computations.
+   *
+   * The chord algorithm needs internal scalars of order \f$ (2D)^2
+   * \f$, where \a D bounds the point components: \c int64_t are
+   * enough for components smaller than 440000000 (naive planes), and
+   * \c int128_t for components smaller than \f$ 10^{18} \f$. The
+   * object starts its computations with \c int64_t and keeps track of
+   * the biggest component of the points it is given. As soon as a
+   * point breaks the bound, the current points are transferred (with
+   * one batched extension) to a ChordNaivePlaneComputer with
+   * \c int128_t (when WITH_INT128 is defined) or BigInteger (when
+   * DGtal is built with GMP), which is used afterwards. This switch
+   * is transparent to the user and does not change the set of
+   * recognized points. Only successful extensions switch: the wider
+   * computer is filled and extended aside, and replaces the current
+   * one only if the extension succeeds. Const queries (operator(),
+   * isExtendable) involving such a point are evaluated by a temporary
+   * wider computer filled with the current points, and leave the
+   * object unchanged. Like with ChordNaivePlaneComputer, const
+   * queries use temporary internal states of the current computer
+   * and must not be called concurrently on the same object.
+   *
+   * It is a model of boost::DefaultConstructible,
+   * boost::CopyConstructible, boost::Assignable,
+   * boost::ForwardContainer, concepts::CAdditivePrimitiveComputer,
+   * concepts::CPointPredicate, exactly like ChordNaivePlaneComputer.
+   *
+   @code
+   typedef SpaceND<3,int> Z3;
+   typedef ChordAdaptiveNaivePlaneComputer< Z3, Z3::Point > NaivePlaneComputer;
+   NaivePlaneComputer plane;
+   plane.init( 2, 1, 1 ); // axis is z, width is 1/1 => naive
+   plane.extend( Point( 10, 0, 0 ) ); // return 'true', int64_t computations
+   @endcode
+   *
+   * @tparam TSpace specifies the digital space (provides dimension and
+   * types for the primitive)
+   *
+   * @tparam TInputPoint specifies the type of the input points
+   * (digital or not).
+   *
+   * @see ChordNaivePlaneComputer
+   */
+  template < typename TSpace,
+             typename TInputPoint = typename TSpace::Point >
+  class ChordAdaptiveNaivePlaneComputer
+  {
+
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace< TSpace > ));
+    BOOST_STATIC_ASSERT(( TSpace::dimension == 3 ));
+    BOOST_STATIC_ASSERT(( TInputPoint::dimension == 3 ));
+
+    // ----------------------- public types ------------------------------
+  public:
+    typedef TSpace Space;
+    typedef TInputPoint InputPoint;
+    typedef typename InputPoint::Component Component;
+    typedef typename Space::Point Point;
+    typedef std::set< InputPoint > InputPointSet;
+    typedef typename InputPointSet::size_type Size;
+    typedef typename InputPointSet::const_iterator ConstIterator;
+    typedef typename InputPointSet::iterator Iterator;
+    /// The machine integer type used whenever possible.
+    typedef DGtal::int64_t SmallInteger;
+#ifdef WITH_BIGINTEGER
+    /// The integer type used when machine integers may overflow.
+    typedef DGtal::BigInteger LargeInteger;
+#else
+    /// The integer type used when machine integers may overflow
+    /// (without GMP, there is no safer choice).
+    typedef DGtal::int64_t LargeInteger;
+#endif
+#ifdef WITH_INT128
+    /// The wider machine integer type used before falling back to LargeInteger.
+    typedef DGtal::int128_t MediumInteger;
+#else
+    /// Without 128-bit integers, the medium level is never used.
+    typedef LargeInteger MediumInteger;
+#endif
+    typedef ChordNaivePlaneComputer< Space, InputPoint, SmallInteger > SmallComputer;
+    typedef ChordNaivePlaneComputer< Space, InputPoint, MediumInteger > MediumComputer;
+    typedef ChordNaivePlaneComputer< Space, InputPoint, LargeInteger > LargeComputer;
+
+    /// The kind of integers used in internal computations.
+    enum IntegerLevel { SMALL_INTEGER = 0, MEDIUM_INTEGER = 1, LARGE_INTEGER = 2 };
+    typedef typename SmallComputer::Primitive Primitive;
+
+    // ----------------------- std public types ------------------------------
+  public:
+    typedef typename InputPointSet::const_iterator const_iterator;
+    typedef typename InputPointSet::const_pointer const_pointer;
+    typedef typename InputPointSet::const_reference const_reference;
+    typedef typename InputPointSet::value_type value_type;
+    typedef typename InputPointSet::difference_type difference_type;
+    typedef typename InputPointSet::size_type size_type;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~ChordAdaptiveNaivePlaneComputer();
+
+    /**
+     * Constructor. The object is not valid and should be initialized.
+     * @see init
+     */
+    ChordAdaptiveNaivePlaneComputer();
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    ChordAdaptiveNaivePlaneComputer ( const ChordAdaptiveNaivePlaneComputer & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    ChordAdaptiveNaivePlaneComputer & operator= ( const ChordAdaptiveNaivePlaneComputer & other );
+
+    /**
+     * Tells if machine integers are enough for points whose
+     * components are bounded by \a maxComponent.
+     *
+     * @param maxComponent an upper bound on the absolute value of point components.
+     * @param widthNumerator the numerator of the maximal axis-width.
+     * @param widthDenominator the denominator of the maximal axis-width.
+     *
+     * @return 'true' iff a ChordNaivePlaneComputer with SmallInteger
+     * can be used safely with these parameters.
+     */
+    static bool fitsSmallInteger( double maxComponent,
+                                  DGtal::int64_t widthNumerator = 1,
+                                  DGtal::int64_t widthDenominator = 1 );
+
+    /**
+     * Tells if 128-bit machine integers are enough for points whose
+     * components are bounded by \a maxComponent.
+     *
+     * @param maxComponent an upper bound on the absolute value of point components.
+     * @param widthNumerator the numerator of the maximal axis-width.
+     * @param widthDenominator the denominator of the maximal axis-width.
+     *
+     * @return 'true' iff a ChordNaivePlaneComputer with MediumInteger
+     * can be used safely with these parameters (always 'false'
+     * without WITH_INT128).
+     */
+    static bool fitsMediumInteger( double maxComponent,
+                                   DGtal::int64_t widthNumerator = 1,
+                                   DGtal::int64_t widthDenominator = 1 );
+
+    /**
+     * @return the kind of integers currently used.
+     */
+    IntegerLevel integerLevel() const;
+
+    /**
+     * @return 'true' iff the current computations are done with
+     * LargeInteger (i.e. some point has broken all the bounds).
+     */
+    bool isLarge() const;
+
+    /**
+     * Clear the object, free memory. The plane keeps its main axis
+     * and width, but contains no point. Computations start again
+     * with machine integers.
+     */
+    void clear();
+
+    /**
+     * All these parameters cannot be changed during the process.
+     * After this call, the object is in a consistent state and can
+     * accept new points for recognition. Calls clear so that the
+     * object is ready to be extended.
+     *
+     * @param axis the main axis (0,1,2) for x, y or z.
+     *
+     * @param widthNumerator the maximal axis-width (x,y,or z) for the
+     * plane is defined as the rational number \a widthNumerator / \a
+     * widthDenominator (default is 1/1, i.e. naive plane).
+     *
+     * @param widthDenominator the maximal axis-width (x,y,or z) for
+     * the plane is defined as the rational number \a widthNumerator /
+     * \a widthDenominator (default is 1/1, i.e. naive plane).
+     */
+    void init( Dimension axis,
+               DGtal::int64_t widthNumerator = 1,
+               DGtal::int64_t widthDenominator = 1 );
+
+    //-------------------- model of ForwardContainer -----------------------------
+  public:
+
+    /**
+     * @return the number of distinct points in the current naive plane.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' if and only if this object contains no point.
+     */
+    bool empty() const;
+
+    /**
+     * @return a const iterator pointing on the first point stored in the current naive plane.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator pointing after the last point stored in the current naive plane.
+     */
+    ConstIterator end() const;
+
+    /**
+     * NB: std version.
+     * @return the maximal allowed number of points in the current naive plane.
+     * @see maxSize
+     */
+    Size max_size() const;
+
+    /**
+     * same as max_size
+     * @return the maximal allowed number of points in the current naive plane.
+     */
+    Size maxSize() const;
+
+    //-------------------- model of concepts::CPointPredicate -----------------------------
+  public:
+
+    /**
+     * Checks if the point \a p is in the current digital plane.
+     *
+     * @param p any 3D point.
+     * @return 'true' if it is in the current plane, false otherwise.
+     */
+    bool operator()( const Point & p ) const;
+
+    //-------------------- model of CIncrementalPrimitiveComputer -----------------------------
+  public:
+
+    /**
+     * Adds the point \a p to this plane if it is within the current
+     * bounds. The plane parameters are not updated.
+     *
+     * @param p any 3D point.
+     * @return 'true' if \a p is in the plane, 'false' otherwise (the
+     * object is then in its original state).
+     */
+    bool extendAsIs( const InputPoint & p );
+
+    /**
+     * Adds the point \a p and checks if we have still a digital plane
+     * of specified width. The plane parameters may be updated so as
+     * to include the new point.
+     *
+     * @param p any 3D point.
+     * @return 'true' if it is still a plane, 'false' otherwise (the
+     * object is then in its original state).
+     */
+    bool extend( const InputPoint & p );
+
+    /**
+     * Checks if we have still a digital plane of specified width when
+     * adding point \a p. The object is left unchanged whatever the
+     * returned value.
+     *
+     * @param p any 3D point.
+     * @return 'true' if this is still a plane, 'false' otherwise.
+     */
+    bool isExtendable( const InputPoint & p ) const;
+
+    //-------------------- model of CAdditivePrimitiveComputer -----------------------------
+  public:
+
+    /**
+     * Adds the range of points [\a it, \a itE) and checks if we have
+     * still a digital plane of specified width. The whole range is
+     * given at once to the chord algorithm.
+     *
+     * @tparam TInputIterator any model of ForwardIterator on InputPoint.
+     * @param it an iterator on the first element of the range of 3D points.
+     * @param itE an iterator after the last element of the range of 3D points.
+     *
+     * @return 'true' if it is still a plane, 'false' otherwise (the
+     * object is then in its original state).
+     */
+    template <typename TInputIterator>
+    bool extend( TInputIterator it, TInputIterator itE );
+
+    /**
+     * Checks if we have still a digital plane of specified width when
+     * adding the range of points [\a it, \a itE). The object is left
+     * unchanged whatever the returned value.
+     *
+     * @tparam TInputIterator any model of ForwardIterator on InputPoint.
+     * @param it an iterator on the first element of the range of 3D points.
+     * @param itE an iterator after the last element of the range of 3D points.
+     *
+     * @return 'true' if this is still a plane, 'false' otherwise.
+     */
+    template <typename TInputIterator>
+    bool isExtendable( TInputIterator it, TInputIterator itE ) const;
+
+    //-------------------- Primitive services -----------------------------
+  public:
+
+    /**
+       @return the current primitive recognized by this computer,
+       which is a ParallelStrip of axis width smaller than the one
+       specified at instanciation.
+    */
+    Primitive primitive() const;
+
+    //-------------------- Parameters services -----------------------------
+  public:
+
+    /**
+     * @tparam Vector3D any type T such that T.operator[](int i)
+     * returns a reference to a double. i ranges in 0,1,2.
+     *
+     * @param[in,out] normal the current normal vector
+     */
+    template <typename Vector3D>
+    void getNormal( Vector3D & normal ) const;
+
+    /**
+     * @tparam Vector3D any type T such that T.operator[](int i)
+     * returns a reference to a double. i ranges in 0,1,2.
+     *
+     * @param[in,out] normal the current unit normal vector
+     */
+    template <typename Vector3D>
+    void getUnitNormal( Vector3D & normal ) const;
+
+    /**
+     * If n is the unit normal to the current plane, then n.x >= min
+     * and n.x <= max are the two half-planes defining it.
+     *
+     * @param min the lower bound (corresponding to the unit vector).
+     * @param max the upper bound (corresponding to the unit vector).
+     */
+    void getBounds( double & min, double & max ) const;
+
+    /**
+     * @pre ! empty()
+     * @return the current minimal point of the plane.
+     */
+    const InputPoint & minimalPoint() const;
+
+    /**
+     * @pre ! empty()
+     * @return the current maximal point of the plane.
+     */
+    const InputPoint & maximalPoint() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    Dimension myAxis;                 /**< the main axis. */
+    DGtal::int64_t myWidth[ 2 ];      /**< the plane width as a rational number myWidth[0]/myWidth[1] */
+    IntegerLevel myLevel;            /**< The kind of integers currently used. */
+    SmallComputer mySmallComputer;   /**< The chord computer with 64-bit integers. */
+    MediumComputer myMediumComputer; /**< The chord computer with 128-bit integers. */
+    LargeComputer myLargeComputer;   /**< The chord computer with big integers. */
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @tparam TPoint the type of point (InputPoint or Point).
+     * @param p any point.
+     * @return the kind of integers needed to process the current
+     * points and the point \a p (not smaller than integerLevel()).
+     */
+    template <typename TPoint>
+    IntegerLevel neededLevel( const TPoint & p ) const;
+
+    /**
+     * @tparam TInputIterator any model of ForwardIterator on InputPoint.
+     * @param it an iterator on the first element of the range of 3D points.
+     * @param itE an iterator after the last element of the range of 3D points.
+     * @return the kind of integers needed to process the current
+     * points and the points of the range [\a it, \a itE) (not
+     * smaller than integerLevel()).
+     */
+    template <typename TInputIterator>
+    IntegerLevel neededLevel( TInputIterator it, TInputIterator itE ) const;
+
+    /**
+     * @param level any kind of integers.
+     * @return 'true' iff computations can be done with integers of
+     * kind \a level (i.e. unless \a level is LARGE_INTEGER and DGtal
+     * is built without GMP).
+     */
+    static bool isAvailable( IntegerLevel level );
+
+    /**
+     * Initializes the chord computer \a wider with the axis and width
+     * of this object, and extends it with the current points.
+     *
+     * @tparam TComputer the type of a wider chord computer.
+     * @param[out] wider the computer to fill.
+     */
+    template <typename TComputer>
+    void fillWiderComputer( TComputer & wider ) const;
+
+    /**
+     * Applies the modifying operation \a op to the computer with
+     * integers of kind \a level if it is wider than the current one
+     * (filled aside, and used afterwards only if \a op succeeds), or
+     * to the current computer otherwise.
+     *
+     * @tparam TOperation the type of a functor C -> bool, for any chord computer type C.
+     * @param level the kind of integers needed by the operation.
+     * @param op the operation.
+     * @return the value returned by \a op.
+     */
+    template <typename TOperation>
+    bool modify( IntegerLevel level, const TOperation & op );
+
+    /**
+     * Applies the const operation \a op to a temporary computer with
+     * integers of kind \a level if it is wider than the current one,
+     * or to the current computer otherwise. The object is unchanged.
+     *
+     * @tparam TOperation the type of a functor const C -> bool, for any chord computer type C.
+     * @param level the kind of integers needed by the operation.
+     * @param op the operation.
+     * @return the value returned by \a op.
+     */
+    template <typename TOperation>
+    bool query( IntegerLevel level, const TOperation & op ) const;
+
+    /// Operation extendAsIs( p ) on any chord computer.
+    struct ExtendAsIsOperation {
+      const InputPoint & p;
+      template <typename C> bool operator()( C & c ) const { return c.extendAsIs( p ); }
+    };
+    /// Operation extend( p ) on any chord computer.
+    struct ExtendOperation {
+      const InputPoint & p;
+      template <typename C> bool operator()( C & c ) const { return c.extend( p ); }
+    };
+    /// Operation extend( it, itE ) on any chord computer.
+    template <typename TInputIterator>
+    struct ExtendRangeOperation {
+      TInputIterator it, itE;
+      template <typename C> bool operator()( C & c ) const { return c.extend( it, itE ); }
+    };
+    /// Operation operator()( p ) on any chord computer.
+    struct ContainsOperation {
+      const Point & p;
+      template <typename C> bool operator()( const C & c ) const { return c( p ); }
+    };
+    /// Operation isExtendable( p ) on any chord computer.
+    struct IsExtendableOperation {
+      const InputPoint & p;
+      template <typename C> bool operator()( const C & c ) const { return c.isExtendable( p ); }
+    };
+    /// Operation isExtendable( it, itE ) on any chord computer.
+    template <typename TInputIterator>
+    struct IsExtendableRangeOperation {
+      TInputIterator it, itE;
+      template <typename C> bool operator()( const C & c ) const { return c.isExtendable( it, itE ); }
+    };
+
+  }; // end of class ChordAdaptiveNaivePlaneComputer
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ChordAdaptiveNaivePlaneComputer'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ChordAdaptiveNaivePlaneComputer' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace, typename TInputPoint>
+  std::ostream&
+  operator<< ( std::ostream & out, const ChordAdaptiveNaivePlaneComputer<TSpace, TInputPoint> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/ChordAdaptiveNaivePlaneComputer.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ChordAdaptiveNaivePlaneComputer_h
+
+#undef ChordAdaptiveNaivePlaneComputer_RECURSES
+#endif // else defined(ChordAdaptiveNaivePlaneComputer_RECURSES)
@@ -44,6 +44,7 @@
 #include <tuple>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/linalg/EigenDecomposition.h"
+#include "DGtal/math/linalg/EigenDecompositionBatch.h"
 #include "DGtal/math/linalg/CMatrix.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -97,18 +98,33 @@ namespace DGtal {
       */
       Value operator()( const Argument& arg ) const
       {
-        EigenDecomposition<Space::dimension, Component, Matrix>
+        EigenDecompositionBatch<Space::dimension, Component, Matrix>
           ::getEigenDecomposition( arg, eigenVectors, eigenValues );
+        return fromEigenDecomposition( eigenVectors, eigenValues );
+      }
 
-        ASSERT ( !std::isnan(eigenValues[0]) ); // NaN
+      /**
+      * Computes the quantity from the eigen decomposition of a covariance
+      * matrix, e.g. when many matrices are diagonalized together
+      * (see EigenDecompositionBatch).
+      * @param vectors the eigenvectors of the covariance matrix, in columns.
+      * @param values its eigenvalues, sorted in ascending order.
+      *
+      * @return the normal direction for the II covariance matrix,
+      * which is the eigenvector associated with the smallest
+      * eigenvalue.
+      */
+      Value fromEigenDecomposition( const Matrix& vectors, const RealVector& values ) const
+      {
+        ASSERT ( !std::isnan(values[0]) ); // NaN
 #ifdef DEBUG
         for( Dimension i_dim = 1; i_dim < Space::dimension; ++i_dim )
         {
-          ASSERT ( std::abs(eigenValues[i_dim - 1]) <= std::abs(eigenValues[i_dim]) );
+          ASSERT ( std::abs(values[i_dim - 1]) <= std::abs(values[i_dim]) );
         }
 #endif
 
-        return eigenVectors.column( 0 ); // normal vector is associated to smallest eigenvalue.
+        return vectors.column( 0 ); // normal vector is associated to smallest eigenvalue.
       }
 
       /**
@@ -172,17 +188,32 @@ namespace DGtal {
       */
       Value operator()( const Argument& arg ) const
       {
-        EigenDecomposition<Space::dimension, Component, Matrix>
+        EigenDecompositionBatch<Space::dimension, Component, Matrix>
           ::getEigenDecomposition( arg, eigenVectors, eigenValues );
+        return fromEigenDecomposition( eigenVectors, eigenValues );
+      }
 
-        ASSERT ( !std::isnan(eigenValues[0]) ); // NaN
+      /**
+      * Computes the quantity from the eigen decomposition of a covariance
+      * matrix, e.g. when many matrices are diagonalized together
+      * (see EigenDecompositionBatch).
+      * @param vectors the eigenvectors of the covariance matrix, in columns.
+      * @param values its eigenvalues, sorted in ascending order.
+      *
+      * @return the tangent direction for the II covariance matrix,
+      * which is the eigenvector associated with the highest
+      * eigenvalue.
+      */
+      Value fromEigenDecomposition( const Matrix& vectors, const RealVector& values ) const
+      {
+        ASSERT ( !std::isnan(values[0]) ); // NaN
 #ifdef DEBUG
         for( Dimension i_dim = 1; i_dim < Space::dimension; ++i_dim )
         {
-          ASSERT ( std::abs(eigenValues[i_dim - 1]) <= std::abs(eigenValues[i_dim]) );
+          ASSERT ( std::abs(values[i_dim - 1]) <= std::abs(values[i_dim]) );
         }
 #endif
-        return eigenVectors.column( 1 ); // tangent vector is associated to greatest eigenvalue.
+        return vectors.column( 1 ); // tangent vector is associated to greatest eigenvalue.
       }
 
       /**
@@ -250,18 +281,33 @@ namespace DGtal {
       */
       Value operator()( const Argument& arg ) const
       {
-        EigenDecomposition<Space::dimension, Component, Matrix>
+        EigenDecompositionBatch<Space::dimension, Component, Matrix>
           ::getEigenDecomposition( arg, eigenVectors, eigenValues );
+        return fromEigenDecomposition( eigenVectors, eigenValues );
+      }
 
-        ASSERT ( !std::isnan(eigenValues[0]) ); // NaN
+      /**
+      * Computes the quantity from the eigen decomposition of a covariance
+      * matrix, e.g. when many matrices are diagonalized together
+      * (see EigenDecompositionBatch).
+      * @param vectors the eigenvectors of the covariance matrix, in columns.
+      * @param values its eigenvalues, sorted in ascending order.
+      *
+      * @return the first principal curvature direction for the II
+      * covariance matrix, which is the eigenvector associated with
+      * the highest eigenvalue.
+      */
+      Value fromEigenDecomposition( const Matrix& vectors, const RealVector& values ) const
+      {
+        ASSERT ( !std::isnan(values[0]) ); // NaN
 #ifdef DEBUG
         for( Dimension i_dim = 1; i_dim < Space::dimension; ++i_dim )
         {
-          ASSERT ( std::abs(eigenValues[i_dim - 1]) <= std::abs(eigenValues[i_dim]) );
+          ASSERT ( std::abs(values[i_dim - 1]) <= std::abs(values[i_dim]) );
         }
 #endif
 
-        return eigenVectors.column( Space::dimension - 1 ); // first principal curvature direction is associated to greatest eigenvalue.
+        return vectors.column( Space::dimension - 1 ); // first principal curvature direction is associated to greatest eigenvalue.
       }
 
       /**
@@ -329,18 +375,33 @@ namespace DGtal {
       */
       Value operator()( const Argument& arg ) const
       {
-        EigenDecomposition<Space::dimension, Component, Matrix>
+        EigenDecompositionBatch<Space::dimension, Component, Matrix>
           ::getEigenDecomposition( arg, eigenVectors, eigenValues );
+        return fromEigenDecomposition( eigenVectors, eigenValues );
+      }
 
-        ASSERT ( !std::isnan(eigenValues[0]) ); // NaN
+      /**
+      * Computes the quantity from the eigen decomposition of a covariance
+      * matrix, e.g. when many matrices are diagonalized together
+      * (see EigenDecompositionBatch).
+      * @param vectors the eigenvectors of the covariance matrix, in columns.
+      * @param values its eigenvalues, sorted in ascending order.
+      *
+      * @return the second principal curvature direction for the II
+      * covariance matrix, which is the eigenvector associated with
+      * the highest eigenvalue.
+      */
+      Value fromEigenDecomposition( const Matrix& vectors, const RealVector& values ) const
+      {
+        ASSERT ( !std::isnan(values[0]) ); // NaN
 #ifdef DEBUG
         for( Dimension i_dim = 1; i_dim < Space::dimension; ++i_dim )
         {
-          ASSERT ( std::abs(eigenValues[i_dim - 1]) <= std::abs(eigenValues[i_dim]) );
+          ASSERT ( std::abs(values[i_dim - 1]) <= std::abs(values[i_dim]) );
         }
 #endif
 
-        return eigenVectors.column( Space::dimension - 2 ); // second principal curvature direction is associated to greatest eigenvalue.
+        return vectors.column( Space::dimension - 2 ); // second principal curvature direction is associated to greatest eigenvalue.
       }
 
       /**
@@ -407,20 +468,35 @@ namespace DGtal {
       */
       Value operator()( const Argument& arg ) const
       {
-        EigenDecomposition<Space::dimension, Component, Matrix>
+        EigenDecompositionBatch<Space::dimension, Component, Matrix>
           ::getEigenDecomposition( arg, eigenVectors, eigenValues );
+        return fromEigenDecomposition( eigenVectors, eigenValues );
+      }
 
-        ASSERT ( !std::isnan(eigenValues[0]) ); // NaN
+      /**
+      * Computes the quantity from the eigen decomposition of a covariance
+      * matrix, e.g. when many matrices are diagonalized together
+      * (see EigenDecompositionBatch).
+      * @param vectors the eigenvectors of the covariance matrix, in columns.
+      * @param values its eigenvalues, sorted in ascending order.
+      *
+      * @return the first and the second principal curvature direction in
+      * a std::pair for the II covariance matrix, which is the eigenvector
+      * associated with the highest eigenvalues.
+      */
+      Value fromEigenDecomposition( const Matrix& vectors, const RealVector& values ) const
+      {
+        ASSERT ( !std::isnan(values[0]) ); // NaN
 #ifdef DEBUG
         for( Dimension i_dim = 1; i_dim < Space::dimension; ++i_dim )
         {
-          ASSERT ( std::abs(eigenValues[i_dim - 1]) <= std::abs(eigenValues[i_dim]) );
+          ASSERT ( std::abs(values[i_dim - 1]) <= std::abs(values[i_dim]) );
         }
 #endif
 
         return Value(
-                eigenVectors.column( Space::dimension - 1 ),
-                eigenVectors.column( Space::dimension - 2 )
+                vectors.column( Space::dimension - 1 ),
+                vectors.column( Space::dimension - 2 )
                 );
       }
 
@@ -483,19 +559,34 @@ namespace DGtal {
       */
       Value operator()( const Argument& arg ) const
       {
-        Argument cp_arg = arg;
-        cp_arg *= dh5;
-        EigenDecomposition<Space::dimension, Component, Matrix>
-          ::getEigenDecomposition( cp_arg, eigenVectors, eigenValues );
-
-        ASSERT ( !std::isnan(eigenValues[0]) ); // NaN
-        ASSERT ( (std::abs(eigenValues[0]) <= std::abs(eigenValues[1]))
-                && (std::abs(eigenValues[1]) <= std::abs(eigenValues[2])) );
-
-        Quantity res(d6_PIr6 * ( eigenValues[2] - ( 3.0 * eigenValues[1] )) + d8_5r,
-                     d6_PIr6 * ( eigenValues[1] - ( 3.0 * eigenValues[2] )) + d8_5r,
-                     eigenVectors.column( Space::dimension - 1 ),
-                     eigenVectors.column( Space::dimension - 2 ));
+        EigenDecompositionBatch<Space::dimension, Component, Matrix>
+          ::getEigenDecomposition( arg, eigenVectors, eigenValues );
+        return fromEigenDecomposition( eigenVectors, eigenValues );
+      }
+
+      /**
+      * Computes the quantity from the eigen decomposition of a covariance
+      * matrix, e.g. when many matrices are diagonalized together
+      * (see EigenDecompositionBatch).
+      * @param vectors the eigenvectors of the covariance matrix, in columns.
+      * @param values its eigenvalues, sorted in ascending order.
+      *
+      * @return the principal curvature values and directions in
+      * a std::tuple.
+      */
+      Value fromEigenDecomposition( const Matrix& vectors, const RealVector& values ) const
+      {
+        // Eigenvalues of the covariance matrix scaled by h^5.
+        const RealVector scaledValues = values * dh5;
+
+        ASSERT ( !std::isnan(scaledValues[0]) ); // NaN
+        ASSERT ( (std::abs(scaledValues[0]) <= std::abs(scaledValues[1]))
+                && (std::abs(scaledValues[1]) <= std::abs(scaledValues[2])) );
+
+        Quantity res(d6_PIr6 * ( scaledValues[2] - ( 3.0 * scaledValues[1] )) + d8_5r,
+                     d6_PIr6 * ( scaledValues[1] - ( 3.0 * scaledValues[2] )) + d8_5r,
+                     vectors.column( Space::dimension - 1 ),
+                     vectors.column( Space::dimension - 2 ));
         return res;
       }
 
@@ -689,17 +780,32 @@ namespace DGtal {
       */
       Value operator()( const Argument& arg ) const
       {
-        Argument cp_arg = arg;
-        cp_arg *= dh5;
-        EigenDecomposition<Space::dimension, Component, Matrix>
-          ::getEigenDecomposition( cp_arg, eigenVectors, eigenValues );
+        EigenDecompositionBatch<Space::dimension, Component, Matrix>
+          ::getEigenDecomposition( arg, eigenVectors, eigenValues );
+        return fromEigenDecomposition( eigenVectors, eigenValues );
+      }
+
+      /**
+      * Computes the quantity from the eigen decomposition of a covariance
+      * matrix, e.g. when many matrices are diagonalized together
+      * (see EigenDecompositionBatch).
+      * @param vectors the eigenvectors of the covariance matrix, in columns.
+      * @param values its eigenvalues, sorted in ascending order.
+      *
+      * @return the Gaussian curvature value for the II
+      * covariance matrix, which is the second highest eigenvalue * second highest eigenvalue.
+      */
+      Value fromEigenDecomposition( const Matrix& /* vectors */, const RealVector& values ) const
+      {
+        // Eigenvalues of the covariance matrix scaled by h^5.
+        const RealVector scaledValues = values * dh5;
 
-        ASSERT ( !std::isnan(eigenValues[0]) ); // NaN
-        ASSERT ( (std::abs(eigenValues[0]) <= std::abs(eigenValues[1]))
-              && (std::abs(eigenValues[1]) <= std::abs(eigenValues[2])) );
+        ASSERT ( !std::isnan(scaledValues[0]) ); // NaN
+        ASSERT ( (std::abs(scaledValues[0]) <= std::abs(scaledValues[1]))
+              && (std::abs(scaledValues[1]) <= std::abs(scaledValues[2])) );
 
-        Value k1 = d6_PIr6 * ( eigenValues[2] - ( 3.0 * eigenValues[1] )) + d8_5r;
-        Value k2 = d6_PIr6 * ( eigenValues[1] - ( 3.0 * eigenValues[2] )) + d8_5r;
+        Value k1 = d6_PIr6 * ( scaledValues[2] - ( 3.0 * scaledValues[1] )) + d8_5r;
+        Value k2 = d6_PIr6 * ( scaledValues[1] - ( 3.0 * scaledValues[2] )) + d8_5r;
         return k1 * k2;
       }
 
@@ -772,17 +878,32 @@ namespace DGtal {
       */
       Value operator()( const Argument& arg ) const
       {
-        Argument cp_arg = arg;
-        cp_arg *= dh5;
-        EigenDecomposition<Space::dimension, Component, Matrix>
-          ::getEigenDecomposition( cp_arg, eigenVectors, eigenValues );
+        EigenDecompositionBatch<Space::dimension, Component, Matrix>
+          ::getEigenDecomposition( arg, eigenVectors, eigenValues );
+        return fromEigenDecomposition( eigenVectors, eigenValues );
+      }
+
+      /**
+      * Computes the quantity from the eigen decomposition of a covariance
+      * matrix, e.g. when many matrices are diagonalized together
+      * (see EigenDecompositionBatch).
+      * @param vectors the eigenvectors of the covariance matrix, in columns.
+      * @param values its eigenvalues, sorted in ascending order.
+      *
+      * @return the first principal curvature value for the II
+      * covariance matrix, which is the highest eigenvalue.
+      */
+      Value fromEigenDecomposition( const Matrix& /* vectors */, const RealVector& values ) const
+      {
+        // Eigenvalues of the covariance matrix scaled by h^5.
+        const RealVector scaledValues = values * dh5;
 
-        ASSERT ( !std::isnan(eigenValues[0]) ); // NaN
-        ASSERT ( (std::abs(eigenValues[0]) <= std::abs(eigenValues[1]))
-              && (std::abs(eigenValues[1]) <= std::abs(eigenValues[2])) );
+        ASSERT ( !std::isnan(scaledValues[0]) ); // NaN
+        ASSERT ( (std::abs(scaledValues[0]) <= std::abs(scaledValues[1]))
+              && (std::abs(scaledValues[1]) <= std::abs(scaledValues[2])) );
 
 
-        return d6_PIr6 * ( eigenValues[2] - ( 3.0 * eigenValues[1] )) + d8_5r;
+        return d6_PIr6 * ( scaledValues[2] - ( 3.0 * scaledValues[1] )) + d8_5r;
       }
 
       /**
@@ -854,16 +975,31 @@ namespace DGtal {
       */
       Value operator()( const Argument& arg ) const
       {
-        Argument cp_arg = arg;
-        cp_arg *= dh5;
-        EigenDecomposition<Space::dimension, Component, Matrix>
-          ::getEigenDecomposition( cp_arg, eigenVectors, eigenValues );
+        EigenDecompositionBatch<Space::dimension, Component, Matrix>
+          ::getEigenDecomposition( arg, eigenVectors, eigenValues );
+        return fromEigenDecomposition( eigenVectors, eigenValues );
+      }
+
+      /**
+      * Computes the quantity from the eigen decomposition of a covariance
+      * matrix, e.g. when many matrices are diagonalized together
+      * (see EigenDecompositionBatch).
+      * @param vectors the eigenvectors of the covariance matrix, in columns.
+      * @param values its eigenvalues, sorted in ascending order.
+      *
+      * @return the second principal curvature value for the II
+      * covariance matrix, which is the second highest eigenvalue.
+      */
+      Value fromEigenDecomposition( const Matrix& /* vectors */, const RealVector& values ) const
+      {
+        // Eigenvalues of the covariance matrix scaled by h^5.
+        const RealVector scaledValues = values * dh5;
 
-        ASSERT ( !std::isnan(eigenValues[0]) ); // NaN
-        ASSERT ( (std::abs(eigenValues[0]) <= std::abs(eigenValues[1]))
-              && (std::abs(eigenValues[1]) <= std::abs(eigenValues[2])) );
+        ASSERT ( !std::isnan(scaledValues[0]) ); // NaN
+        ASSERT ( (std::abs(scaledValues[0]) <= std::abs(scaledValues[1]))
+              && (std::abs(scaledValues[1]) <= std::abs(scaledValues[2])) );
 
-        return d6_PIr6 * ( eigenValues[1] - ( 3.0 * eigenValues[2] )) + d8_5r;
+        return d6_PIr6 * ( scaledValues[1] - ( 3.0 * scaledValues[2] )) + d8_5r;
       }
 
       /**
@@ -936,18 +1072,34 @@ namespace DGtal {
       */
       Value operator()( const Argument& arg ) const
       {
-        Argument cp_arg = arg;
-        cp_arg *= dh5;
-        EigenDecomposition<Space::dimension, Component, Matrix>
-          ::getEigenDecomposition( cp_arg, eigenVectors, eigenValues );
+        EigenDecompositionBatch<Space::dimension, Component, Matrix>
+          ::getEigenDecomposition( arg, eigenVectors, eigenValues );
+        return fromEigenDecomposition( eigenVectors, eigenValues );
+      }
+
+      /**
+      * Computes the quantity from the eigen decomposition of a covariance
+      * matrix, e.g. when many matrices are diagonalized together
+      * (see EigenDecompositionBatch).
+      * @param vectors the eigenvectors of the covariance matrix, in columns.
+      * @param values its eigenvalues, sorted in ascending order.
+      *
+      * @return the first and the second principal curvature value in a
+      * std::pair for the II covariance matrix, which are the first and the
+      * second highest eigenvalue.
+      */
+      Value fromEigenDecomposition( const Matrix& /* vectors */, const RealVector& values ) const
+      {
+        // Eigenvalues of the covariance matrix scaled by h^5.
+        const RealVector scaledValues = values * dh5;
 
-        ASSERT ( !std::isnan(eigenValues[0]) ); // NaN
-        ASSERT ( (std::abs(eigenValues[0]) <= std::abs(eigenValues[1]))
-              && (std::abs(eigenValues[1]) <= std::abs(eigenValues[2])) );
+        ASSERT ( !std::isnan(scaledValues[0]) ); // NaN
+        ASSERT ( (std::abs(scaledValues[0]) <= std::abs(scaledValues[1]))
+              && (std::abs(scaledValues[1]) <= std::abs(scaledValues[2])) );
 
         return Value(
-                d6_PIr6 * ( eigenValues[2] - ( 3.0 * eigenValues[1] )) + d8_5r,
-                d6_PIr6 * ( eigenValues[1] - ( 3.0 * eigenValues[2] )) + d8_5r
+                d6_PIr6 * ( scaledValues[2] - ( 3.0 * scaledValues[1] )) + d8_5r,
+                d6_PIr6 * ( scaledValues[1] - ( 3.0 * scaledValues[2] )) + d8_5r
                );
       }
 
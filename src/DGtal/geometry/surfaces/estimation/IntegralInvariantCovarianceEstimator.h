@@ -44,7 +44,11 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <iterator>
+#include <vector>
+#include <type_traits>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/Instrumentation.h"
 
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/kernel/BasicPointFunctors.h"
@@ -57,6 +61,7 @@
 
 #include "DGtal/geometry/surfaces/DigitalSurfaceConvolver.h"
 #include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
+#include "DGtal/math/linalg/EigenDecompositionBatch.h"
 #include "DGtal/shapes/EuclideanShapesDecorator.h"
 
 #include "DGtal/shapes/implicit/ImplicitBall.h"
@@ -66,6 +71,116 @@
 namespace DGtal
 {
 
+namespace detail
+{
+  /**
+   * Tells if a covariance matrix functor can compute its quantity
+   * from the eigen decomposition of the matrix, i.e. if it has a
+   * method fromEigenDecomposition (like the functors of
+   * IIGeometricFunctors). Then IntegralInvariantCovarianceEstimator
+   * diagonalizes the covariance matrices by batches.
+   *
+   * @tparam TFunctor the type of the covariance matrix functor.
+   */
+  template <typename TFunctor>
+  struct HasFromEigenDecomposition
+  {
+    template <typename F>
+    static char test( decltype( &F::fromEigenDecomposition ) );
+    template <typename F>
+    static long test( ... );
+    static const bool value = sizeof( test<TFunctor>( 0 ) ) == sizeof( char );
+  };
+
+  /**
+   * An output iterator on covariance matrices that stores them in an
+   * EigenDecompositionBatch. Each time the batch is full, the
+   * matrices are diagonalized together and the quantities computed by
+   * the functor from their eigen decompositions are written on another
+   * output iterator. Used by IntegralInvariantCovarianceEstimator.
+   *
+   * @tparam TFunctor the type of the covariance matrix functor, with a
+   * method fromEigenDecomposition.
+   * @tparam TOutputIterator the type of the output iterator of quantities.
+   */
+  template <typename TFunctor, typename TOutputIterator>
+  class EigenDecompositionBatchOutputIterator
+  {
+  public:
+    typedef std::output_iterator_tag iterator_category;
+    typedef void value_type;
+    typedef void difference_type;
+    typedef void pointer;
+    typedef void reference;
+    typedef typename TFunctor::Space Space;
+    typedef typename TFunctor::Matrix Matrix;
+    typedef typename TFunctor::RealVector RealVector;
+    typedef typename TFunctor::Component Component;
+    typedef EigenDecompositionBatch< Space::dimension, Component, Matrix > Batch;
+
+    /**
+     * Constructor.
+     * @param functor the covariance matrix functor.
+     * @param result the output iterator of quantities.
+     * @param batchSize the number of matrices diagonalized together.
+     */
+    EigenDecompositionBatchOutputIterator( const TFunctor & functor,
+                                           TOutputIterator result,
+                                           std::size_t batchSize )
+      : myFunctor( functor ), myResult( result ), myBatch( batchSize ), myNb( 0 ) {}
+
+    EigenDecompositionBatchOutputIterator & operator*()     { return *this; }
+    EigenDecompositionBatchOutputIterator & operator++()    { return *this; }
+    EigenDecompositionBatchOutputIterator & operator++(int) { return *this; }
+
+    /**
+     * Appends a covariance matrix to the batch.
+     * @param matrix a covariance matrix.
+     * @return itself.
+     */
+    EigenDecompositionBatchOutputIterator & operator=( const Matrix & matrix )
+    {
+      myBatch.setMatrix( myNb++, matrix );
+      if ( myNb == myBatch.size() ) flush();
+      return *this;
+    }
+
+    /**
+     * Diagonalizes the matrices of the batch and writes their quantities.
+     * @return the output iterator of quantities after the writing.
+     */
+    TOutputIterator flush()
+    {
+      const std::size_t capacity = myBatch.size();
+      myBatch.resize( myNb );
+      myBatch.compute();
+      for ( std::size_t k = 0; k < myNb; ++k )
+        {
+          myBatch.getEigenVectors( k, myEigenVectors );
+          myBatch.getEigenValues( k, myEigenValues );
+          *myResult++ = myFunctor.fromEigenDecomposition( myEigenVectors, myEigenValues );
+        }
+      myBatch.resize( capacity );
+      myNb = 0;
+      return myResult;
+    }
+
+  private:
+    /// The covariance matrix functor.
+    const TFunctor & myFunctor;
+    /// The output iterator of quantities.
+    TOutputIterator myResult;
+    /// The covariance matrices of the batch.
+    Batch myBatch;
+    /// The number of matrices in the batch.
+    std::size_t myNb;
+    /// A data member only used for temporary calculations.
+    Matrix myEigenVectors;
+    /// A data member only used for temporary calculations.
+    RealVector myEigenValues;
+  }; // end of class EigenDecompositionBatchOutputIterator
+} // namespace detail
+
 /////////////////////////////////////////////////////////////////////////////
 // template class IntegralInvariantCovarianceEstimator
 /**
@@ -159,6 +274,8 @@ public:
   typedef typename Convolver::CovarianceMatrix Matrix;
   typedef typename Matrix::Component Component;
   typedef double Scalar;
+  /// The number of covariance matrices diagonalized together by the range eval.
+  static const std::size_t batchSize = 4096;
   BOOST_CONCEPT_ASSERT (( concepts::CCellFunctor< ShapeSpelFunctor > ));
   BOOST_CONCEPT_ASSERT (( concepts::CUnaryFunctor< CovarianceMatrixFunctor, Matrix, Quantity > ));
   BOOST_STATIC_ASSERT (( concepts::ConceptUtils::SameType< typename Convolver::CovarianceMatrix, 
@@ -273,6 +390,10 @@ public:
   * CovarianceMatrixFunctor to extract some geometric information.
   * Return the result on an OutputIterator (param).
   *
+  * When the functor has a method fromEigenDecomposition (see
+  * IIGeometricFunctors), covariance matrices are diagonalized together
+  * by batches of \ref batchSize surfels with EigenDecompositionBatch.
+  *
   * @tparam OutputIterator type of Iterator of an array of Quantity
   * @tparam SurfelConstIterator type of Iterator on a Surfel
   *
@@ -321,6 +442,35 @@ private:
 
 private:
 
+  /**
+  * Range eval when the functor is applied to each covariance matrix.
+  *
+  * @param[in] itb iterator defining the start of the range of surfels.
+  * @param[in] ite iterator defining the end of the range of surfels.
+  * @param[in] result output iterator of results of the computation.
+  * @return the updated output iterator after all outputs.
+  */
+  template <typename OutputIterator, typename SurfelConstIterator>
+  OutputIterator evalRange( SurfelConstIterator itb,
+                            SurfelConstIterator ite,
+                            OutputIterator result,
+                            std::false_type ) const;
+
+  /**
+  * Range eval when the functor computes its quantity from the eigen
+  * decomposition of each covariance matrix: matrices are diagonalized
+  * by batches of \ref batchSize surfels.
+  *
+  * @param[in] itb iterator defining the start of the range of surfels.
+  * @param[in] ite iterator defining the end of the range of surfels.
+  * @param[in] result output iterator of results of the computation.
+  * @return the updated output iterator after all outputs.
+  */
+  template <typename OutputIterator, typename SurfelConstIterator>
+  OutputIterator evalRange( SurfelConstIterator itb,
+                            SurfelConstIterator ite,
+                            OutputIterator result,
+                            std::true_type ) const;
 
 }; // end of class IntegralInvariantCovarianceEstimator
 
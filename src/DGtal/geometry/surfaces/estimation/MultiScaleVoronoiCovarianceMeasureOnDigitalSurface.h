@@ -0,0 +1,335 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MultiScaleVoronoiCovarianceMeasureOnDigitalSurface.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module MultiScaleVoronoiCovarianceMeasureOnDigitalSurface.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MultiScaleVoronoiCovarianceMeasureOnDigitalSurface_RECURSES)
+#error Recursive header files inclusion detected in MultiScaleVoronoiCovarianceMeasureOnDigitalSurface.h
+#else // defined(MultiScaleVoronoiCovarianceMeasureOnDigitalSurface_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MultiScaleVoronoiCovarianceMeasureOnDigitalSurface_RECURSES
+
+#if !defined MultiScaleVoronoiCovarianceMeasureOnDigitalSurface_h
+/** Prevents repeated inclusion of headers. */
+#define MultiScaleVoronoiCovarianceMeasureOnDigitalSurface_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Instrumentation.h"
+#include "DGtal/base/CountedConstPtrOrConstPtr.h"
+#include "DGtal/kernel/Point2ScalarFunctors.h"
+#include "DGtal/math/linalg/EigenDecomposition.h"
+#include "DGtal/math/linalg/EigenDecompositionBatch.h"
+#include "DGtal/topology/CDigitalSurfaceContainer.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
+#include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
+#include "DGtal/geometry/volumes/estimation/MultiScaleVoronoiCovarianceMeasure.h"
+#include "DGtal/geometry/surfaces/estimation/VoronoiCovarianceMeasureOnDigitalSurface.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MultiScaleVoronoiCovarianceMeasureOnDigitalSurface
+  /**
+   * Description of template class
+   * 'MultiScaleVoronoiCovarianceMeasureOnDigitalSurface' <p> \brief
+   * Aim: This class computes the Voronoi covariance measure of a
+   * digital surface for several pairs of radii (R,r) at once. It
+   * provides the same services as
+   * VoronoiCovarianceMeasureOnDigitalSurface for each scale, but
+   * the Voronoi map, the proximity structure and the trivial normals
+   * are computed only once.
+   *
+   * Surfels and points are indexed (from 0) and results are stored
+   * in vectors indexed by scale, then by surfel or point index. The
+   * integration of the VCM with the kernel functions and the
+   * diagonalization are done in parallel if DGtal has been built
+   * with OpenMP support.
+   *
+   * @see VoronoiCovarianceMeasureOnDigitalSurface
+   * @see MultiScaleVoronoiCovarianceMeasure
+   *
+   * @tparam TDigitalSurfaceContainer the type of digital surface
+   * container (model of CDigitalSurfaceContainer).
+   *
+   * @tparam TSeparableMetric a model of CSeparableMetric used for
+   * computing the Voronoi map (e.g. Euclidean metric is
+   * DGtal::ExactPredicateLpSeparableMetric<TSpace, 2> )
+   *
+   * @tparam TKernelFunction the type of the kernel function chi_r used
+   * for integrating the VCM, a map: Point -> Scalar.
+   */
+  template <typename TDigitalSurfaceContainer, typename TSeparableMetric,
+            typename TKernelFunction>
+  class MultiScaleVoronoiCovarianceMeasureOnDigitalSurface
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CDigitalSurfaceContainer< TDigitalSurfaceContainer > ));
+    BOOST_CONCEPT_ASSERT(( concepts::CSeparableMetric<TSeparableMetric> ));
+    // ----------------------- public types ------------------------------
+  public:
+    typedef TDigitalSurfaceContainer DigitalSurfaceContainer; ///< the chosen container
+    typedef TSeparableMetric                         Metric;  ///< the chosen metric
+    typedef TKernelFunction                  KernelFunction;  ///< the kernel function
+    typedef DigitalSurface<DigitalSurfaceContainer> Surface;  ///< the chosen digital surface
+    typedef typename DigitalSurfaceContainer::KSpace KSpace;  ///< the cellular space
+    typedef typename DigitalSurfaceContainer::Surfel Surfel;  ///< the n-1 cells
+    typedef typename KSpace::Space                    Space;  ///< the digital space
+    typedef typename KSpace::Point                    Point;  ///< the digital points
+    typedef MultiScaleVoronoiCovarianceMeasure<Space,Metric> VCM; ///< the multi-scale Voronoi Covariance Measure
+    typedef typename VCM::Scalar                     Scalar;  ///< the "real number" type
+    typedef typename VCM::Index                       Index;  ///< the index type for scales, points and surfels
+    typedef typename Surface::ConstIterator   ConstIterator;  ///< the iterator for traversing the surface
+    typedef EigenDecompositionBatch<KSpace::dimension,Scalar> LinearAlgebraTool;  ///< diagonalizer (nD), by batches.
+    typedef typename VCM::VectorN                   VectorN;  ///< n-dimensional R-vector
+    typedef typename VCM::MatrixNN                 MatrixNN;  ///< nxn R-matrix
+
+    BOOST_CONCEPT_ASSERT(( concepts::CUnaryFunctor<KernelFunction, Point, Scalar> ));
+
+    /// Structure to hold a diagonalized matrix.
+    struct EigenStructure {
+      VectorN values;   ///< eigenvalues from the smallest to the biggest
+      MatrixNN vectors; ///< corresponding eigenvectors
+    };
+    typedef std::vector<Surfel>                   SurfelRange; ///< the indexed surfels
+    typedef std::unordered_map<Surfel,Index>     Surfel2Index; ///< the map Surfel -> index
+    typedef std::vector<EigenStructure>    EigenStructureRange; ///< eigen structures indexed by point index
+    typedef std::vector<VectorN>                 VectorNRange; ///< vectors indexed by surfel index
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~MultiScaleVoronoiCovarianceMeasureOnDigitalSurface();
+
+    /**
+     * Constructor. Computes the VCM of the given \a surface at every scale.
+     *
+     * @param _surface the digital surface that is aliased in this. The
+     * user can \b secure the aliasing by passing a
+     * CountedConstPtrOrConstPtr.
+     *
+     * @param _surfelEmbedding the chosen embedding for surfels.
+     *
+     * @param Rs the offset radius R of each scale.
+     *
+     * @param rs the radius r of the support of the kernel function of each scale.
+     *
+     * @param chis the kernel function of each scale, whose support
+     * has radius less or equal to the corresponding radius in \a rs.
+     *
+     * @param t the radius for the trivial normal estimator, which is
+     * used for finding the correct orientation inside/outside for the
+     * VCM.
+     *
+     * @param aMetric an instance of the metric (used for the Voronoi map construction).
+     *
+     * @param verbose if 'true' displays information on ongoing computation.
+     *
+     * @pre \a Rs, \a rs and \a chis have the same non-zero size.
+     */
+    MultiScaleVoronoiCovarianceMeasureOnDigitalSurface
+    ( ConstAlias< Surface > _surface,
+      Surfel2PointEmbedding _surfelEmbedding,
+      const std::vector<Scalar>& Rs, const std::vector<Scalar>& rs,
+      const std::vector<KernelFunction>& chis,
+      Scalar t = 2.5, Metric aMetric = Metric(),
+      bool verbose = false );
+
+    /// the const-aliased digital surface.
+    CountedConstPtrOrConstPtr< Surface > surface() const;
+    /// the chosen embedding Surfel -> Point(s)
+    Surfel2PointEmbedding surfelEmbedding() const;
+    /// @return the number of scales.
+    Index nbScales() const;
+    /// @param k any scale index.
+    /// @return the parameter R of scale \a k.
+    Scalar R( Index k ) const;
+    /// @param k any scale index.
+    /// @return the parameter r of scale \a k.
+    Scalar r( Index k ) const;
+    /// @return the radius for the trivial normal estimator.
+    Scalar radiusTrivial() const;
+
+    /// @return the multi-scale VCM of the embedded points, notably
+    /// giving the point indices.
+    const VCM& vcm() const;
+
+    /// @return the surfels of the surface, in the order of their index.
+    const SurfelRange& surfels() const;
+
+    /// @param s any surfel.
+    /// @return the index of \a s if it belongs to the surface, `surfels().size()` otherwise.
+    Index index( const Surfel& s ) const;
+
+    /**
+       @param[in] outIt an output iterator on Point to write the point(s) associated to surfel \a s.
+       @param[in] s the surfel that is embedded in the digital space according to mySurfelEmbedding.
+       @return the (modified) output iterator after the write operations.
+    */
+    template <typename PointOutputIterator>
+    PointOutputIterator getPoints( PointOutputIterator outIt, Surfel s ) const;
+
+    /// @param k any scale index.
+    /// @return the VCM normals of every surfel at scale \a k, indexed by surfel index.
+    const VectorNRange& vcmNormals( Index k ) const;
+
+    /// @return the trivial normals of every surfel, indexed by surfel index.
+    const VectorNRange& trivialNormals() const;
+
+    /// @param k any scale index.
+    /// @return the eigen structures of the chi_r VCM of every point
+    /// at scale \a k, indexed by point index (see vcm().index).
+    const EigenStructureRange& eigenStructures( Index k ) const;
+
+    /**
+       Gets the eigenvalues of the chi_r VCM at surfel \a s and scale
+       \a k sorted from lowest to highest.
+       @param[in] k any scale index.
+       @param[out] values the eigenvalues of the chi_r VCM at \a s.
+       @param[in] s the surfel
+       @return 'true' is the surfel \a s was valid.
+    */
+    bool getChiVCMEigenvalues( Index k, VectorN& values, Surfel s ) const;
+
+    /**
+       Gets the eigen decomposition of the chi_r VCM at surfel \a s and scale \a k.
+       @param[in] k any scale index.
+       @param[out] values the eigenvalues of the chi_r VCM at \a s sorted from lowest to highest..
+       @param[out] vectors the eigenvectors of the chi_r VCM at \a s associated to \a values.
+       @param[in] s the surfel
+       @return 'true' is the surfel \a s was valid.
+    */
+    bool getChiVCMEigenStructure( Index k, VectorN& values, MatrixNN& vectors, Surfel s ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// (possibly secure) alias of the digital surface
+    CountedConstPtrOrConstPtr< Surface > mySurface;
+    /// The chosen embedding for the surfels.
+    Surfel2PointEmbedding mySurfelEmbedding;
+    /// The radius r of each scale.
+    std::vector<Scalar> mySmallRs;
+    /// The kernel function chi_r of each scale.
+    std::vector<KernelFunction> myChis;
+    /// Stores the multi-scale voronoi covariance measure of the point embedding of the surface.
+    VCM myVCM;
+    /// Stores the radius for the trivial normal estimator.
+    Scalar myRadiusTrivial;
+    /// The surfels of the surface.
+    SurfelRange mySurfels;
+    /// The map surfel -> index.
+    Surfel2Index mySurfelIndices;
+    /// The points of surfel i are the indices
+    /// mySurfelPoints[ mySurfelPointsStart[ i ] .. mySurfelPointsStart[ i+1 ] ).
+    std::vector<Index> mySurfelPointsStart;
+    /// The point indices of every surfel (see mySurfelPointsStart).
+    std::vector<Index> mySurfelPoints;
+    /// Stores for each scale and each point p its convolved VCM, i.e. VCM( chi_r( p ) )
+    std::vector<EigenStructureRange> myEigenStructures;
+    /// Stores for each scale and each surfel its vcm normal.
+    std::vector<VectorNRange> myVCMNormals;
+    /// Stores for each surfel its trivial normal.
+    VectorNRange myTrivialNormals;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    MultiScaleVoronoiCovarianceMeasureOnDigitalSurface();
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    MultiScaleVoronoiCovarianceMeasureOnDigitalSurface ( const MultiScaleVoronoiCovarianceMeasureOnDigitalSurface & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    MultiScaleVoronoiCovarianceMeasureOnDigitalSurface & operator= ( const MultiScaleVoronoiCovarianceMeasureOnDigitalSurface & other );
+
+  }; // end of class MultiScaleVoronoiCovarianceMeasureOnDigitalSurface
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MultiScaleVoronoiCovarianceMeasureOnDigitalSurface'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MultiScaleVoronoiCovarianceMeasureOnDigitalSurface' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDigitalSurfaceContainer, typename TSeparableMetric, typename TKernelFunction>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const MultiScaleVoronoiCovarianceMeasureOnDigitalSurface<TDigitalSurfaceContainer, TSeparableMetric, TKernelFunction> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/estimation/MultiScaleVoronoiCovarianceMeasureOnDigitalSurface.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MultiScaleVoronoiCovarianceMeasureOnDigitalSurface_h
+
+#undef MultiScaleVoronoiCovarianceMeasureOnDigitalSurface_RECURSES
+#endif // else defined(MultiScaleVoronoiCovarianceMeasureOnDigitalSurface_RECURSES)
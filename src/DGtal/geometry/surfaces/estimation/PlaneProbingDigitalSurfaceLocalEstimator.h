@@ -41,6 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <algorithm>
 #include <unordered_map>
 #include "DGtal/base/Common.h"
 #include "DGtal/geometry/surfaces/DigitalSurfacePredicate.h"
@@ -222,6 +224,13 @@ namespace DGtal
     /**
      * Estimates the quantity on a range of surfels.
      *
+     * Missing pre-estimations are first computed (and cached), then the
+     * surfels are processed independently, in parallel if DGtal has been
+     * built with OpenMP support. Each thread builds one probing algorithm
+     * with the factory and then reuses it for its next surfels through
+     * `InternalProbingAlgorithm::reset(frame.p, { frame.b1, frame.b2, frame.normal })`,
+     * so the factory must build its algorithms with this frame convention.
+     *
      * @param itb an iterator on the start of the range of surfels.
      * @param ite a past-the-end iterator of the range of surfels.
      * @param out an output iterator to store the results.
@@ -314,6 +323,20 @@ namespace DGtal
      */
     std::pair<bool, ProbingFrame> probingFrameWithPreEstimation (ProbingFrame const& aInitialFrame, RealPoint const& aPreEstimation) const;
 
+    /**
+     * Estimates the normal vector on a surfel given its pre-estimation.
+     *
+     * @param aAlgorithm a (possibly null) pointer on a probing
+     * algorithm. If null, an algorithm is built with the probing factory,
+     * otherwise it is reset to the frame of the surfel. The caller is
+     * responsible for deleting it.
+     * @param aSurfel a surfel.
+     * @param aPreEstimation the pre-estimation vector at this surfel.
+     * @return the estimated normal.
+     */
+    Quantity computeNormal (InternalProbingAlgorithm*& aAlgorithm,
+                            Surfel const& aSurfel, RealPoint const& aPreEstimation) const;
+
     /**
      * @param x a scalar.
      * @return an integer that is 1 if x is non-negative, 0 otherwise.
@@ -180,6 +180,15 @@ namespace DGtal
 
     // ----------------------- Plane Probing services ------------------------------
   public:
+    /**
+     * Restarts the estimator from a new initial frame, keeping the
+     * same predicate and bound, without any allocation.
+     *
+     * @param aPoint the base point of the new initial frame.
+     * @param aM the three vectors of the new initial frame.
+     */
+    void reset (Point const& aPoint, Triangle const& aM);
+
     /**
      * @param aIndex the index of the vector (between 0 and 2).
      * @return the i-th height vector \f$ m_i \f$.
@@ -171,6 +171,16 @@ namespace DGtal
 
     // ----------------------- Plane Probing services ------------------------------
   public:
+    /**
+     * Restarts the estimator from a new initial frame. The neighborhood
+     * and the internal buffers are kept, so that a single estimator
+     * may be reused on many initial frames without any allocation.
+     *
+     * @param aPoint the base point of the new initial frame.
+     * @param aM the three vectors of the new initial frame.
+     */
+    void reset (Point const& aPoint, Triangle const& aM);
+
     /**
      * @param aIndex the index of the vector (between 0 and 2).
      * @return the i-th height vector \f$ m_i \f$.
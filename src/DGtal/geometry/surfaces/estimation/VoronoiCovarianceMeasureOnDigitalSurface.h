@@ -42,9 +42,11 @@
 // Inclusions
 #include <iostream>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/Instrumentation.h"
 #include "DGtal/base/CountedConstPtrOrConstPtr.h"
 #include "DGtal/kernel/Point2ScalarFunctors.h"
 #include "DGtal/math/linalg/EigenDecomposition.h"
+#include "DGtal/math/linalg/EigenDecompositionBatch.h"
 #include "DGtal/topology/CDigitalSurfaceContainer.h"
 #include "DGtal/topology/DigitalSurface.h"
 #include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
@@ -101,7 +103,7 @@ namespace DGtal
     typedef VoronoiCovarianceMeasure<Space,Metric>      VCM;  ///< the Voronoi Covariance Measure
     typedef typename VCM::Scalar                     Scalar;  ///< the "real number" type
     typedef typename Surface::ConstIterator   ConstIterator;  ///< the iterator for traversing the surface
-    typedef EigenDecomposition<KSpace::dimension,Scalar> LinearAlgebraTool;  ///< diagonalizer (nD).
+    typedef EigenDecompositionBatch<KSpace::dimension,Scalar> LinearAlgebraTool;  ///< diagonalizer (nD), by batches.
     typedef typename VCM::VectorN                   VectorN;  ///< n-dimensional R-vector
     typedef typename VCM::MatrixNN                 MatrixNN;  ///< nxn R-matrix
 
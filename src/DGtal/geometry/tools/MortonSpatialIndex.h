@@ -0,0 +1,303 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MortonSpatialIndex.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module MortonSpatialIndex.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MortonSpatialIndex_RECURSES)
+#error Recursive header files inclusion detected in MortonSpatialIndex.h
+#else // defined(MortonSpatialIndex_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MortonSpatialIndex_RECURSES
+
+#if !defined MortonSpatialIndex_h
+/** Prevents repeated inclusion of headers. */
+#define MortonSpatialIndex_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <array>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MortonSpatialIndex
+  /**
+     Description of template class 'MortonSpatialIndex' <p> \brief
+     Aim: A static spatial index over a set of (digital or real)
+     points, answering radius and k-nearest-neighbor queries, one at a
+     time or in parallel batches.
+
+     The bounding box of the points is subdivided into cubical cells
+     of edge cellSize(). Points are sorted along the Morton (Z-order)
+     curve of their cell and stored contiguously, cell after cell, in
+     a compressed sparse row layout: only non-empty cells are stored,
+     as a sorted array of Morton keys with the offsets of their
+     points. Since the Morton order is hierarchical, each aligned
+     block of \f$ 2^l \f$ cells per axis is a contiguous range of
+     points and any box of cells lies within one range of keys, which
+     is either scanned or probed cell by cell, whichever is cheaper.
+
+     Contrary to SpatialCubicalSubdivision, the domain need not be
+     known in advance, bins are not allocated separately and the
+     structure is immutable once built: all queries are const and
+     may be called concurrently from several threads.
+
+     @code
+     MortonSpatialIndex< Z3i::RealPoint > index( pts.begin(), pts.end() );
+     std::vector< std::size_t > neighbors;
+     index.kNearestQuery( pts[ 0 ], 10, neighbors ); // indices in pts
+     std::vector< std::vector< std::size_t > > all;
+     index.radiusQueries( pts, 2.0, all );           // parallel (OpenMP)
+     @endcode
+
+     @tparam TPoint the type of points, a PointVector with integer or
+     real coordinates.
+   */
+  template <typename TPoint>
+  class MortonSpatialIndex
+  {
+  public:
+    typedef TPoint                                 Point;
+    static const Dimension dimension = Point::dimension;
+    typedef PointVector< dimension, double >      RealPoint;
+    typedef std::size_t                            Size;
+    typedef std::size_t                            Index;
+    typedef DGtal::uint64_t                        Key;
+    typedef std::array< Key, dimension >           Cell;
+    typedef MortonSpatialIndex< TPoint >           Self;
+
+    /// The number of bits of each cell coordinate in a Morton key.
+    static const Size bits_per_axis = ( 64 / dimension < 31 ) ? 64 / dimension : 31;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Default constructor. The index is empty.
+    MortonSpatialIndex();
+
+    /**
+       Constructor from a range of points.
+
+       @tparam PointIterator a model of forward iterator on Point.
+       @param itb an iterator pointing at the beginning of the range.
+       @param ite an iterator pointing after the end of the range.
+       @param cell_size the edge size of each cell, or 0 to choose
+       it automatically (about 8 points per cell).
+    */
+    template <typename PointIterator>
+    MortonSpatialIndex( PointIterator itb, PointIterator ite, double cell_size = 0.0 );
+
+    /**
+       Builds the index of a range of points. Query results are
+       indices of points in this range.
+
+       @tparam PointIterator a model of forward iterator on Point.
+       @param itb an iterator pointing at the beginning of the range.
+       @param ite an iterator pointing after the end of the range.
+       @param cell_size the edge size of each cell, or 0 to choose
+       it automatically (about 8 points per cell).
+    */
+    template <typename PointIterator>
+    void init( PointIterator itb, PointIterator ite, double cell_size = 0.0 );
+
+    /// Empties the index.
+    void clear();
+
+    /// @return the number of indexed points.
+    Size size() const;
+
+    /// @return the number of non-empty cells.
+    Size nbCells() const;
+
+    /// @return the edge size of each cell.
+    double cellSize() const;
+
+    /// @return the number of cells along each axis of the grid.
+    const Cell& gridSize() const;
+
+    // ----------------------- Query services ------------------------------
+  public:
+
+    /**
+       Outputs the points at Euclidean distance at most \a r from \a q.
+
+       @param q any point.
+       @param r the radius of the query.
+       @param[out] result the indices of these points, in increasing order.
+    */
+    void radiusQuery( const Point& q, double r, std::vector< Index >& result ) const;
+
+    /**
+       Outputs the \a k points closest to \a q (or all points if there
+       are less than \a k), ties being broken by index.
+
+       @param q any point.
+       @param k the number of neighbors.
+       @param[out] result the indices of these points, by increasing distance to \a q.
+    */
+    void kNearestQuery( const Point& q, Size k, std::vector< Index >& result ) const;
+
+    /**
+       @param q any point.
+       @return the index of the point closest to \a q (the smallest
+       one in case of tie).
+       @pre size() > 0
+    */
+    Index nearest( const Point& q ) const;
+
+    /**
+       Radius queries for each point of \a queries, computed in
+       parallel (OpenMP).
+
+       @param queries the query points.
+       @param r the radius of the queries.
+       @param[out] results the result of radiusQuery for each query point.
+    */
+    void radiusQueries( const std::vector< Point >& queries, double r,
+                        std::vector< std::vector< Index > >& results ) const;
+
+    /**
+       k-nearest-neighbor queries for each point of \a queries,
+       computed in parallel (OpenMP).
+
+       @param queries the query points.
+       @param k the number of neighbors.
+       @param[out] results the result of kNearestQuery for each query point.
+    */
+    void kNearestQueries( const std::vector< Point >& queries, Size k,
+                          std::vector< std::vector< Index > >& results ) const;
+
+    // ----------------------- Morton services ------------------------------
+  public:
+
+    /**
+       @param c any cell whose coordinates hold in bits_per_axis bits.
+       @return its Morton key, interleaving the bits of its coordinates.
+    */
+    static Key encode( const Cell& c );
+
+    /**
+       @param k any Morton key.
+       @return the cell of key \a k.
+    */
+    static Cell decode( Key k );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The lowest corner of the grid.
+    RealPoint myLower;
+    /// The edge size of each cell.
+    double myCellSize;
+    /// A tolerance on cell bounds, to cope with rounding errors.
+    double myTolerance;
+    /// The number of cells along each axis.
+    Cell myGridSize;
+    /// The points sorted by Morton key of their cell.
+    std::vector< Point > myPoints;
+    /// The index in the input range of each sorted point.
+    std::vector< Index > myIndices;
+    /// The sorted Morton keys of the non-empty cells.
+    std::vector< Key > myKeys;
+    /// The points of the c-th non-empty cell are [myOffsets[c],myOffsets[c+1]).
+    std::vector< Index > myOffsets;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @return the point \a p with real coordinates.
+    static RealPoint toReal( const Point& p );
+
+    /// @return the cell containing \a p, clamped to the grid.
+    Cell cellOf( const RealPoint& p ) const;
+
+    /// @return the squared distance between \a p and the (slightly
+    /// enlarged) box of cell \a c.
+    double squaredDistanceToCell( const RealPoint& p, const Cell& c ) const;
+
+    /// @return the squared distance between \a p and the farthest
+    /// point of the (slightly enlarged) box of cell \a c.
+    double squaredMaxDistanceToCell( const RealPoint& p, const Cell& c ) const;
+
+    /**
+       Calls f( c, cell ) for each non-empty cell, of index c in
+       myKeys, within the box of cells [lo,hi] and accepted by the
+       predicate \a accept. The range of keys of the box is scanned if
+       it is small enough, otherwise each accepted cell of the box is
+       searched in it.
+    */
+    template <typename CellPredicate, typename CellFunctor>
+    void forEachCellInBox( const Cell& lo, const Cell& hi,
+                           const CellPredicate& accept, CellFunctor f ) const;
+
+  }; // end of class MortonSpatialIndex
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MortonSpatialIndex'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MortonSpatialIndex' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPoint>
+  std::ostream&
+  operator<< ( std::ostream & out, const MortonSpatialIndex<TPoint> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/tools/MortonSpatialIndex.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MortonSpatialIndex_h
+
+#undef MortonSpatialIndex_RECURSES
+#endif // else defined(MortonSpatialIndex_RECURSES)
@@ -41,12 +41,14 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <queue>
 #include <set>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Clock.h"
+#include "DGtal/base/Instrumentation.h"
 #include "DGtal/geometry/tools/QuickHullKernels.h"
 
 namespace DGtal
@@ -257,7 +259,8 @@ namespace DGtal
     /// @param[in] K a kernel for computing facet geometries.
     /// @param[in] dbg the trace level, from 0 (no) to 3 (very verbose).
     QuickHull( const Kernel& K = Kernel(), int dbg = 0 )
-      : kernel( K ), debug_level( dbg ), myStatus( Status::Uninitialized )
+      : kernel( K ), debug_level( dbg ), parallel_threshold( 4096 ),
+        myStatus( Status::Uninitialized )
     {}
 
     /// @return the current status of this object, in Uninitialized,
@@ -382,6 +385,8 @@ namespace DGtal
     bool setInput( const std::vector< InputPoint >& input_points,
                    bool remove_duplicates = true )
     {
+      DGTAL_INSTRUMENT_SCOPE( "QuickHull::setInput" );
+      DGTAL_INSTRUMENT_COUNT( "QuickHull::setInput/nb input points", input_points.size() );
       Clock tic;
       tic.startClock();
       clear();
@@ -397,6 +402,84 @@ namespace DGtal
       return true;
     }
 
+    /// Removes from the input points the ones that lie strictly inside
+    /// the convex hull of a few extremal points (along axes, and along
+    /// diagonals up to dimension 4), in the spirit of the
+    /// Akl-Toussaint heuristic. These points can neither be vertices
+    /// nor lie on the boundary of the convex hull, hence the output is
+    /// unchanged while the core algorithm processes much less points
+    /// for large dense inputs (like digital sets).
+    ///
+    /// @pre status() must be Status::InputInitialized
+    ///
+    /// @note Mappings `input2comp` and `comp2input` are updated:
+    /// removed input points are mapped to UNASSIGNED. Indices given
+    /// afterwards to setInitialSimplex refer to the filtered points.
+    /// Calling it again is harmless: points removed by a previous call
+    /// stay UNASSIGNED.
+    ///
+    /// @note Does nothing for kernels with infinite facets (Delaunay
+    /// computations), or if there are too few points.
+    ///
+    /// @return the number of removed points.
+    Size filterInteriorPoints()
+    {
+      if ( status() != Status::InputInitialized || kernel.hasInfiniteFacets() )
+        return 0;
+      const Size nb_axes = 2 * dimension;
+      const Size nb_dirs = nb_axes + ( dimension <= 4 ? ( 1 << dimension ) : 0 );
+      if ( points.size() <= 4 * nb_dirs ) return 0;
+      // Extracts the extremal points along each direction.
+      IndexRange extremal;
+      for ( Size k = 0; k < nb_dirs; k++ ) {
+        Vector dir = Vector::zero;
+        if ( k < nb_axes ) dir[ k / 2 ] = ( k % 2 ) ? -1 : 1;
+        else
+          for ( Dimension i = 0; i < dimension; i++ )
+            dir[ i ] = ( ( ( k - nb_axes ) >> i ) & 1 ) ? -1 : 1;
+        Index  best   = 0;
+        Scalar best_d = dir.dot( points[ 0 ] );
+        for ( Index i = 1; i < points.size(); i++ ) {
+          const Scalar d = dir.dot( points[ i ] );
+          if ( d > best_d ) { best = i; best_d = d; }
+        }
+        extremal.push_back( best );
+      }
+      std::sort( extremal.begin(), extremal.end() );
+      extremal.erase( std::unique( extremal.begin(), extremal.end() ),
+                      extremal.end() );
+      if ( extremal.size() <= dimension ) return 0;
+      // Computes the hull of extremal points.
+      QuickHull< Kernel > inner( kernel );
+      for ( auto i : extremal ) inner.points.push_back( points[ i ] );
+      inner.myStatus = Status::InputInitialized;
+      if ( ! inner.computeConvexHull( Status::FacetsCompleted ) ) return 0;
+      // Keeps points that are not strictly inside this hull.
+      const long nb = (long) points.size();
+      std::vector< char > keep( points.size(), 0 );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static) if( nb >= (long) parallel_threshold )
+#endif
+      for ( long i = 0; i < nb; i++ )
+        for ( const auto& F : inner.facets )
+          if ( aboveOrOn( F, points[ i ] ) ) { keep[ i ] = 1; break; }
+      // Renumbers points and mappings.
+      IndexRange old2new( points.size(), UNASSIGNED );
+      Index j = 0;
+      for ( Index i = 0; i < points.size(); i++ )
+        if ( keep[ i ] ) {
+          points    [ j ] = points    [ i ];
+          comp2input[ j ] = comp2input[ i ];
+          old2new   [ i ] = j++;
+        }
+      const Size nb_removed = points.size() - j;
+      points.resize( j );
+      comp2input.resize( j );
+      for ( auto& c : input2comp )
+        if ( c != UNASSIGNED ) c = old2new[ c ];
+      return nb_removed;
+    }
+
     /// Sets the initial full dimensional simplex
     ///
     /// @pre status() must be Status::InputInitialized
@@ -461,6 +544,7 @@ namespace DGtal
     {
       if ( target < Status::InputInitialized || target > Status::AllCompleted )
         return false;
+      DGTAL_INSTRUMENT_SCOPE( "QuickHull::computeConvexHull" );
       Clock tic;
       if ( status() == Status::InputInitialized )
         { // Initialization
@@ -503,6 +587,7 @@ namespace DGtal
     /// returns 'false' and the status is NotFullDimensional.
     bool computeInitialSimplex()
     {
+      DGTAL_INSTRUMENT_SCOPE( "QuickHull::computeInitialSimplex" );
       const auto full_simplex = pickInitialSimplex();
       if ( full_simplex.empty() ) {
         myStatus = Status::NotFullDimensional;
@@ -523,6 +608,7 @@ namespace DGtal
     bool computeFacets()
     {
       if ( status() != Status::SimplexCompleted ) return false;
+      DGTAL_INSTRUMENT_SCOPE( "QuickHull::computeFacets" );
       std::queue< Index > Q;
       for ( Index fi = 0; fi < facets.size(); ++fi )
         Q.push( fi );
@@ -532,6 +618,7 @@ namespace DGtal
           trace.info() << "---- Iteration " << n++ << " #Q=" << Q.size() << std::endl;
       }
       cleanFacets();
+      DGTAL_INSTRUMENT_COUNT( "QuickHull::computeFacets/nb facets", facets.size() );
       if ( debug_level >= 2 ) {
         trace.info() << ".... #facets=" << facets.size()
                   << " #deleted=" << deleted_facets.size() << std::endl;
@@ -554,6 +641,7 @@ namespace DGtal
     {
       static const int MAX_NB_VPF = 10 * dimension;
       if ( status() != Status::FacetsCompleted ) return false;
+      DGTAL_INSTRUMENT_SCOPE( "QuickHull::computeVertices" );
 
       // Renumber infinite facets in case of Delaunay triangulation computation.
       renumberInfiniteFacets();
@@ -798,6 +886,9 @@ namespace DGtal
     mutable Kernel kernel;
     /// debug_level from 0:no to 2
     int debug_level; 
+    /// minimal number of points to assign to facets before the
+    /// above/below tests are done in parallel (if OpenMP is enabled).
+    Size parallel_threshold;
     /// the set of points, indexed as in the array.
     std::vector< Point > points;
     /// the surjective mapping between the input range and the output
@@ -1101,23 +1192,23 @@ namespace DGtal
           }
         }
       }
-      // For each new facet F'
-      for ( Index i = 0; i < new_facets.size(); i++ ) {
-        Facet& Fp = facets[ new_facets[ i ] ];
-        Index max_j = outside_pts.size();
-        for ( Index j = 0; j < max_j; ) {
-          const Index v = outside_pts[ j ];
-          if ( above( Fp, points[ v ] ) ) {
-            Fp.outside_set.push_back( v );
-            assignment[ v ]  = new_facets[ i ];
-            outside_pts[ j ] = outside_pts.back();
-            outside_pts.pop_back();
-            max_j--;
-          } else j++;
+      // Assigns each outside point to the first new facet F' it is above.
+      const IndexRange new_assignment = firstFacetsAbove( outside_pts, new_facets );
+      IndexRange inside_pts;
+      for ( Index j = 0; j < outside_pts.size(); j++ ) {
+        const Index v = outside_pts[ j ];
+        const Index f = new_assignment[ j ];
+        if ( f != UNASSIGNED ) {
+          facets[ f ].outside_set.push_back( v );
+          assignment[ v ] = f;
         }
-        if ( debug_level >= 3 ) {
+        else inside_pts.push_back( v );
+      }
+      outside_pts.swap( inside_pts );
+      if ( debug_level >= 3 ) {
+        for ( Index i = 0; i < new_facets.size(); i++ ) {
           trace.info() << "- New facet " << new_facets[ i ] << " ";
-          Fp.display( trace.info() );
+          facets[ new_facets[ i ] ].display( trace.info() );
         }
       }
       // Update processed points
@@ -1157,6 +1248,33 @@ namespace DGtal
       return status() == Status::SimplexCompleted;
     }
   
+    /// Computes for each point of \a pts the first facet of \a fcts
+    /// (in this order) that it lies strictly above. Tests are done in
+    /// parallel (if OpenMP is enabled) when there are at least
+    /// `parallel_threshold` points, since the result does not depend on
+    /// the evaluation order.
+    ///
+    /// @param[in] pts a range of point indices.
+    /// @param[in] fcts a range of valid facet indices.
+    ///
+    /// @return for each point of \a pts, the index of the first facet
+    /// of \a fcts it is above, or UNASSIGNED if there is none.
+    IndexRange firstFacetsAbove( const IndexRange& pts,
+                                 const IndexRange& fcts ) const
+    {
+      const long nb = (long) pts.size();
+      IndexRange result( pts.size(), (Index) UNASSIGNED );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static) if( nb >= (long) parallel_threshold )
+#endif
+      for ( long i = 0; i < nb; i++ ) {
+        const Point& p = points[ pts[ i ] ];
+        for ( auto f : fcts )
+          if ( above( facets[ f ], p ) ) { result[ i ] = f; break; }
+      }
+      return result;
+    }
+    
     /// @return true if the facet is valid
     bool checkFacet( Index f ) const
     {
@@ -1453,7 +1571,6 @@ namespace DGtal
     /// returns 'false' and the status is NotFullDimensional.
     bool computeSimplexConfiguration( const IndexRange& full_simplex )
     {
-      assignment = std::vector< Index >( points.size(), UNASSIGNED );
       facets.resize( dimension + 1 );
       deleted_facets.clear();
       for ( Index j = 0; j < full_simplex.size(); ++j )
@@ -1472,19 +1589,16 @@ namespace DGtal
           for ( auto&& v : isimplex ) facets[ j ].on_set.push_back( v );
           std::sort( facets[ j ].on_set.begin(), facets[ j ].on_set.end() );
         }
-      // List of unassigned vertices
-      for ( Index fi = 0; fi < facets.size(); ++fi ) {
-        Facet& f = facets[ fi ];
-        for ( Index v = 0; v < points.size(); v++ )
-          {
-            if ( assignment[ v ] == UNASSIGNED && above( f, points[ v ] ) ) {
-              f.outside_set.push_back( v );
-              assignment[ v ] = fi;
-            } 
-          }
-      }
+      // Assigns each point to the first facet it is above.
+      IndexRange all_points( points.size() );
+      IndexRange all_facets( facets.size() );
+      for ( Index v = 0; v < points.size(); v++ ) all_points[ v ] = v;
+      for ( Index f = 0; f < facets.size(); f++ ) all_facets[ f ] = f;
+      assignment = firstFacetsAbove( all_points, all_facets );
       for ( Index v = 0; v < points.size(); v++ )
-        if ( assignment[ v ] == UNASSIGNED )
+        if ( assignment[ v ] != UNASSIGNED )
+          facets[ assignment[ v ] ].outside_set.push_back( v );
+        else
           processed_points.push_back( v );
       
       // Display some information
@@ -44,6 +44,9 @@
 #include <string>
 #include <vector>
 #include <array>
+#include <cmath>
+#include <limits>
+#include <type_traits>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CInteger.h"
 #include "DGtal/kernel/NumberTraits.h"
@@ -121,9 +124,9 @@ namespace DGtal
       }
       if ( ! remove_duplicates ) {
         output_values.swap( input );
-        input2output.resize( input.size() );
-        output2input.resize( input.size() );
-        for ( Size i = 0; i < input.size(); ++i )
+        input2output.resize( output_values.size() );
+        output2input.resize( output_values.size() );
+        for ( Size i = 0; i < output_values.size(); ++i )
           input2output[ i ] = output2input[ i ] = i;
       }
       else {
@@ -200,14 +203,30 @@ namespace DGtal
     /// Converter to inner internal integers or lattice points / vector
     typedef IntegerConverter< dim, InternalInteger >   Inner;
     
+    /// When 'true', the position of a point with respect to an
+    /// half-space is first evaluated with floating-point numbers and
+    /// exact arithmetic is used only when this filter is not
+    /// conclusive. It is only worthwhile when internal integers are
+    /// wider than machine integers (int128_t, BigInteger).
+    static const bool floatFilter =
+      ! std::is_integral< InternalInteger >::value
+      || sizeof( InternalInteger ) > sizeof( DGtal::int64_t );
+    
     class HalfSpace {
       friend class ConvexHullCommonKernel< dim, CoordinateInteger, InternalInteger >;
       InternalVector N; ///< the normal vector
       InternalScalar c; ///< the intercept
+      std::array< double, dim > dN; ///< approximation of N for the float filter
+      double dc;                    ///< approximation of c for the float filter
       HalfSpace( const InternalVector& aN, const InternalScalar aC )
-        : N( aN ), c( aC ) {}
+        : N( aN ), c( aC )
+      {
+        for ( Dimension i = 0; i < dim; i++ )
+          dN[ i ] = NumberTraits< InternalScalar >::castToDouble( N[ i ] );
+        dc = NumberTraits< InternalScalar >::castToDouble( c );
+      }
     public:
-      HalfSpace() = default;
+      HalfSpace() : N(), c(), dN(), dc( 0.0 ) {}
       const InternalVector& internalNormal() const    { return N; }
       InternalScalar internalIntercept() const { return c; }
     };
@@ -237,7 +256,7 @@ namespace DGtal
           const InternalPoint  ip = Inner::cast( vpoints[ idx_below ] );
           const InternalScalar nu = hs.N.dot( ip );
           //const Scalar nu = hs.N.dot( vpoints[ idx_below ] );
-          if ( nu > hs.c ) { hs.N = -hs.N; hs.c = -hs.c; }
+          if ( nu > hs.c ) hs = HalfSpace( -hs.N, -hs.c );
         }
       return hs;
     }
@@ -328,23 +347,62 @@ namespace DGtal
       return v < InternalScalar( 0 ) ? -v : v;
     }
 
+    /// Floating-point filter for the sign of the height of a point.
+    ///
+    /// @param H the half-space
+    /// @param p any point
+    ///
+    /// @return 1 (resp. -1) if \a p is certainly strictly above
+    /// (resp. below) this plane, 0 if the floating-point evaluation is
+    /// not conclusive.
+    int filteredSign( const HalfSpace& H, const CoordinatePoint& p ) const
+    {
+      double v = -H.dc;
+      double m = std::fabs( H.dc );
+      for ( Dimension i = 0; i < dim; i++ ) {
+        const double t = H.dN[ i ]
+          * NumberTraits< CoordinateInteger >::castToDouble( p[ i ] );
+        v += t;
+        m += std::fabs( t );
+      }
+      // Bounds the rounding errors of the conversions, products and sums.
+      const double err = ( 2 * dim + 4 )
+        * std::numeric_limits< double >::epsilon() * m;
+      return ( v > err ) ? 1 : ( ( v < -err ) ? -1 : 0 );
+    }
+    
     /// @param H the half-space
     /// @param p any point
     /// @return 'true' iff p is strictly above this plane (so in direction N ).
     bool above( const HalfSpace& H, const CoordinatePoint& p ) const
-    { return height( H, p ) > 0; }
+    {
+      if ( floatFilter ) {
+        const int s = filteredSign( H, p );
+        if ( s != 0 ) return s > 0;
+      }
+      return height( H, p ) > 0;
+    }
 
     /// @param H the half-space
     /// @param p any point
     /// @return 'true' iff p is above or lies on this plane (so in direction N ).
     bool aboveOrOn( const HalfSpace& H, const CoordinatePoint& p ) const
-    { return height( H, p ) >= 0; }
+    {
+      if ( floatFilter ) {
+        const int s = filteredSign( H, p );
+        if ( s != 0 ) return s > 0;
+      }
+      return height( H, p ) >= 0;
+    }
 
     /// @param H the half-space
     /// @param p any point
     /// @return 'true' iff p lies on this plane.
     bool on( const HalfSpace& H, const CoordinatePoint& p ) const
-    { return height( H, p ) == 0; } 
+    {
+      if ( floatFilter && filteredSign( H, p ) != 0 ) return false;
+      return height( H, p ) == 0;
+    } 
     
     
   }; //   template < Dimension dim >  struct ConvexHullIntegralKernel {
@@ -148,6 +148,62 @@ namespace DGtal
      */
     void addDirection(const Vector &aDir);
 
+    /**
+     * Add a range of directions into the accumulator. The bin
+     * coordinates of all directions are computed first, with the
+     * number of bins of each slice tabulated once, then bins are
+     * updated (in parallel with thread-local counters when OpenMP is
+     * available). Counts and representative directions are the same as
+     * with successive calls to addDirection (up to the summation order
+     * of real directions), but in case of ties the max bin is the
+     * first one in bin order.
+     *
+     * @tparam VectorIterator a random access iterator on Vector.
+     * @param itb an iterator pointing at the first direction.
+     * @param ite an iterator pointing after the last direction.
+     */
+    template <typename VectorIterator>
+    void addDirections(VectorIterator itb, VectorIterator ite);
+
+    /**
+     * Adds the samples of another accumulator into this one, for
+     * instance when directions were added to thread-local copies of
+     * an accumulator. In case of ties, the max bin is the first one
+     * in bin order.
+     *
+     * @code
+     * std::vector< SphericalAccumulator<Vector> > local( nb_threads, acc );
+     * // ... thread t calls local[ t ].addDirection( ... )
+     * for ( const auto& a : local ) acc.merge( a );
+     * @endcode
+     *
+     * @pre @a other has the same number of slices as this accumulator.
+     * @param other any accumulator with the same resolution.
+     */
+    void merge(const SphericalAccumulator &other);
+
+    /**
+     * Adaptive (coarse to fine) search of the dominant directions. The
+     * counts are first aggregated into a coarser accumulator, whose
+     * bins are about @a coarsening times larger along each axis. The
+     * most populated fine bin of each of the most populated coarse bins
+     * is a candidate, scored by the samples within one coarse bin size
+     * around it and moved to the most populated bin of this window, so
+     * that peaks split between bins are recovered. Candidates are then
+     * selected by decreasing score, ignoring those too close to an
+     * already selected one (non-maximum suppression).
+     *
+     * @param nb the maximal number of dominant directions.
+     * @param[out] bins the coordinates (posPhi,posTheta) of the
+     * dominant bins, by decreasing score. Only non-empty bins are
+     * returned.
+     * @param coarsening the ratio between the bin sizes of the coarse
+     * accumulator and of this one (at least 1).
+     */
+    void dominantBins(Size nb,
+                      std::vector< std::pair<Size,Size> > &bins,
+                      Size coarsening = 4) const;
+
     /**
      * Given a normalized direction, this method computes the bin
      * coordinates.
@@ -355,7 +411,7 @@ namespace DGtal
      */
     SphericalAccumulator & operator= ( const SphericalAccumulator & other )
     {
-      if (this!=other)
+      if (this!=&other)
       {
         myNphi = other.myNphi;
         myNtheta = other.myNtheta;
@@ -413,6 +469,18 @@ namespace DGtal
         // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * @return the number of valid bins of each slice along the phi
+     * axis (1 for the poles).
+     */
+    std::vector<Size> thetaBinNumbers() const;
+
+    /**
+     * Moves the max bin to the first bin in bin order with a count
+     * greater than the current max count, if any.
+     */
+    void updateMaxCountBin();
+
   }; // end of class SphericalAccumulator
 
 
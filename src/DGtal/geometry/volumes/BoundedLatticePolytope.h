@@ -532,13 +532,47 @@ namespace DGtal
 
     /// @name Enumeration services (counting, get points in polytope)
     /// @{
-    
+
+    /**
+     * Visits the integer points within the polytope row by row. For
+     * each line of the domain parallel to the first axis, the span of
+     * the polytope along this line is computed directly from the
+     * half-spaces and, if not empty, \a f is called with its first and
+     * last points. Rows are visited in the order of the domain.
+     *
+     * @tparam RowFunctor the type of any function or functor with
+     * signature `void( const Point& first, const Point& last )`.
+     *
+     * @param f the function called on each non-empty row of points
+     * (the points of a row only differ by their first coordinate).
+     *
+     * @note The cost is proportional to the number of lines of the
+     * domain times the number of half-spaces, and does not depend on
+     * the number of points within the polytope.
+     */
+    template <typename RowFunctor>
+    void forEachRow( RowFunctor f ) const;
+
+    /**
+     * Visits the integer points within the polytope, in the order of
+     * the domain, without storing them.
+     *
+     * @tparam PointFunctor the type of any function or functor with
+     * signature `void( const Point& p )`.
+     *
+     * @param f the function called on each point within the polytope.
+     */
+    template <typename PointFunctor>
+    void forEachPoint( PointFunctor f ) const;
+
     /**
      * Computes the number of integer points lying within the polytope.
      *
      * @return the number of integer points lying within the polytope.
      *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
+     * @note Obtained by computing the span of the polytope along each
+     * line of its domain (see forEachRow). Slabs of large domains are
+     * processed in parallel when OpenMP is available.
      */
     Integer count() const;
 
@@ -547,7 +581,8 @@ namespace DGtal
      *
      * @return the number of integer points lying within the interior of the polytope.
      *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
+     * @note Obtained by computing the span of the polytope along each
+     * line of its domain (see forEachRow).
      * 
      * @note `count() <= countInterior() + countBoundary()` with
      * equality when the polytope is closed.
@@ -559,7 +594,8 @@ namespace DGtal
      *
      * @return the number of integer points lying on the boundary of the polytope.
      *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
+     * @note Obtained by computing the span of the polytope along each
+     * line of its domain (see forEachRow).
      * 
      * @note `count() <= countInterior() + countBoundary()` with
      * equality when the polytope is closed.
@@ -574,7 +610,8 @@ namespace DGtal
      * @param[in] hi the highest point of the domain.
      * @return the number of integer points within the polytope.
      *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
+     * @note Obtained by computing the span of the polytope along each
+     * line of its domain (see forEachRow).
      */
     Integer countWithin( Point low, Point hi ) const;
 
@@ -592,7 +629,8 @@ namespace DGtal
      *
      * @return the number of integer points within the polytope up to .
      *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
+     * @note Obtained by computing the span of the polytope along each
+     * line of its domain (see forEachRow).
      */
     Integer countUpTo( Integer max ) const;
 
@@ -601,8 +639,9 @@ namespace DGtal
      *
      * @param[out] pts the integer points within the polytope.
      *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
      * @note At output, pts.size() == this->count()
+     * @note Slabs of large domains are processed in parallel when
+     * OpenMP is available, points are output in the order of the domain.
      */
     void getPoints( std::vector<Point>& pts ) const;
 
@@ -611,7 +650,8 @@ namespace DGtal
      *
      * @param[out] pts the integer points interior to the polytope.
      *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
+     * @note Obtained by computing the span of the polytope along each
+     * line of its domain (see forEachRow).
      * @note At output, pts.size() == this->countInterior()
      */
     void getInteriorPoints( std::vector<Point>& pts ) const;
@@ -621,7 +661,8 @@ namespace DGtal
      *
      * @param[out] pts the integer points boundary to the polytope.
      *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
+     * @note Obtained by computing the span of the polytope along each
+     * line of its domain (see forEachRow).
      * @note At output, pts.size() == this->countBoundary()
      */
     void getBoundaryPoints( std::vector<Point>& pts ) const;
@@ -634,7 +675,8 @@ namespace DGtal
      * @param[in,out] pts_set the set of points where points within
      * this polytope are inserted.
      *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
+     * @note Obtained by computing the span of the polytope along each
+     * line of its domain (see forEachRow).
      */
     template <typename PointSet>
     void insertPoints( PointSet& pts_set ) const;
@@ -687,6 +729,66 @@ namespace DGtal
 
     // ------------------------- Internals ------------------------------------
   private:
+    /// @return the number of slabs (along the last axis) of the
+    /// domain that are enumerated in parallel, or 0 if the domain has
+    /// too few rows (or OpenMP not available) and is enumerated sequentially.
+    long nbParallelSlabs() const;
+
+    /// @param s the index of a slab, between 0 and `nbParallelSlabs()`.
+    /// @return the points of the domain whose last coordinate is the
+    /// \a s-th one.
+    Domain slab( long s ) const;
+
+    /// The inequalities that define the rows visited by forEachRowWithin.
+    enum RowMode {
+      PolytopeRows, ///< the inequalities of the polytope (see isInside)
+      LargeRows,    ///< all inequalities are taken as large ones
+      StrictRows    ///< all inequalities are taken as strict ones (see isInterior)
+    };
+
+    /// Computes the span of the polytope along the line parallel to
+    /// the first axis and passing through \a p.
+    ///
+    /// @param[in] p any point, whose first coordinate is ignored.
+    /// @param[in] mode the inequalities that are taken into account.
+    /// @param[in,out] xmin as input, the lowest first coordinate that is
+    /// considered, as output, the lowest first coordinate within the span.
+    /// @param[in,out] xmax as input, the highest first coordinate that is
+    /// considered, as output, the highest first coordinate within the span.
+    /// @return 'true' iff the span is not empty.
+    bool rowSpan( const Point& p, RowMode mode,
+                  Integer& xmin, Integer& xmax ) const;
+
+    /// Visits the non-empty rows of the polytope within the box [lo,hi]
+    /// (included in the domain), see forEachRow.
+    ///
+    /// @param lo the lowest point of the box.
+    /// @param hi the highest point of the box.
+    /// @param mode the inequalities that define the rows.
+    /// @param f the function called on the first and last points of each row.
+    template <typename RowFunctor>
+    void forEachRowWithin( const Point& lo, const Point& hi,
+                           RowMode mode, RowFunctor f ) const;
+
+    /// @param mode the inequalities that define the rows.
+    /// @return the number of points of the rows of the polytope.
+    Integer countRows( RowMode mode ) const;
+
+    /// @param[in] mode the inequalities that define the rows.
+    /// @param[out] pts the points of the rows of the polytope, in the
+    /// order of the domain.
+    void getRowPoints( RowMode mode, std::vector<Point>& pts ) const;
+
+    /// @param a any integer
+    /// @param b any positive integer
+    /// @return the greatest integer lower or equal to a/b.
+    static Integer floorDiv( const Integer& a, const Integer& b );
+
+    /// @param a any integer
+    /// @param b any positive integer
+    /// @return the smallest integer greater or equal to a/b.
+    static Integer ceilDiv( const Integer& a, const Integer& b );
+
     /// In 3D, builds a valid lattice polytope with empty interior
     /// from 3 non-colinear points.
     /// @param a any point such that a, b, and c are not colinear.
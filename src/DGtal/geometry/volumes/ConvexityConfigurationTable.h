@@ -0,0 +1,257 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ConvexityConfigurationTable.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module ConvexityConfigurationTable.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ConvexityConfigurationTable_RECURSES)
+#error Recursive header files inclusion detected in ConvexityConfigurationTable.h
+#else // defined(ConvexityConfigurationTable_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ConvexityConfigurationTable_RECURSES
+
+#if !defined ConvexityConfigurationTable_h
+/** Prevents repeated inclusion of headers. */
+#define ConvexityConfigurationTable_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <bitset>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstExpressions.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ConvexityConfigurationTable
+  /**
+     Description of template class 'ConvexityConfigurationTable' <p>
+     \brief Aim: A table that memorizes convexity properties (full
+     convexity, 0-convexity) of the configurations of a \f$ (2K+1)^d
+     \f$ neighborhood, and that may be shared by several threads.
+
+     Configurations are the bitsets of NeighborhoodConvexityAnalyzer
+     (bits are ordered like the points of the neighborhood domain).
+     Since convexity properties are invariant by the \f$ 2^d d! \f$
+     symmetries of the lattice (permutations and reflections of the
+     axes), results are stored for the canonical configuration of each
+     orbit, i.e. the smallest one among its symmetric images. Queried
+     configurations are also stored as is, so that frequent
+     configurations are found without computing their canonical form.
+
+     The table is split into shards protected by their own mutex, so
+     that concurrent accesses rarely wait for each other.
+
+     @tparam dim the dimension of the digital space.
+     @tparam K the parameter that determines the size of the
+     neighborhood (2K+1 points along each direction).
+
+     @see NeighborhoodConvexityAnalyzer
+  */
+  template < Dimension dim, int K >
+  class ConvexityConfigurationTable
+  {
+  public:
+    typedef ConvexityConfigurationTable< dim, K > Self;
+    typedef std::size_t                            Size;
+
+    static const Dimension dimension  = dim;
+    static const Size      neigh_size = functions::const_pow( 2*K+1, dim );
+
+    typedef std::bitset< functions::const_pow( 2*K+1, dim ) > Configuration;
+
+    /// The properties stored in the table.
+    enum Property {
+      FullConvexity = 0, ///< full convexity
+      ZeroConvexity = 1  ///< digital 0-convexity
+    };
+
+    // ------------------------- Standard services --------------------------------
+  public:
+    /// @name Standard services (construction, initialization, assignment)
+    /// @{
+
+    /// Constructor.
+    /// @param nb_shards the number of independent parts of the table.
+    ConvexityConfigurationTable( Size nb_shards = 64 );
+
+    /// Destructor.
+    ~ConvexityConfigurationTable() = default;
+
+    /// Copy constructor. Forbidden.
+    ConvexityConfigurationTable( const Self& other ) = delete;
+
+    /// Assignment. Forbidden.
+    Self& operator=( const Self& other ) = delete;
+
+    /// @}
+
+    // ------------------------- Table services --------------------------------
+  public:
+    /// @name Table services
+    /// @{
+
+    /// @param cfg any configuration
+    /// @param prop the queried property
+    ///
+    /// @return a pair (value,known) where 'known' is 'true' iff the
+    /// property of \a cfg (or of a symmetric configuration) was stored.
+    ///
+    /// @note Thread-safe.
+    std::pair< bool, bool > get( const Configuration& cfg, Property prop );
+
+    /// Stores the property of a configuration.
+    /// @param cfg any configuration
+    /// @param prop the property
+    /// @param value the value of the property for \a cfg
+    ///
+    /// @note Thread-safe.
+    void set( const Configuration& cfg, Property prop, bool value );
+
+    /// @param cfg any configuration
+    /// @return the smallest configuration among the symmetric images of \a cfg.
+    Configuration canonical( const Configuration& cfg ) const;
+
+    /// @param cfg any configuration
+    /// @param s the index of a symmetry (between 0 and 'nbSymmetries()')
+    /// @return the image of \a cfg by the symmetry \a s.
+    Configuration transform( const Configuration& cfg, Size s ) const;
+
+    /// @return the number of symmetries of the neighborhood, \f$ 2^d d! \f$.
+    Size nbSymmetries() const
+    { return mySymmetries.size(); }
+
+    /// @return the number of stored configurations.
+    /// @note Shards are locked one after the other, so the result may
+    /// miss configurations stored concurrently.
+    Size size() const;
+
+    /// Forgets all the stored configurations.
+    /// @note Shards are locked one after the other.
+    void clear();
+
+    /// @}
+
+    // ------------------------- Interface --------------------------------------
+  public:
+    /// @name Interface
+    /// @{
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /// @}
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /// A part of the table.
+    struct Shard {
+      /// Protects the accesses to the map.
+      std::mutex mutex;
+      /// Associates to configurations the flags of their known properties.
+      std::unordered_map< Configuration, unsigned char > map;
+    };
+
+    /// The number of shards.
+    Size myNbShards;
+    /// The shards of the table.
+    std::unique_ptr< Shard[] > myShards;
+    /// For each symmetry, the image of each bit of a configuration.
+    std::vector< std::vector< Size > > mySymmetries;
+
+    // ------------------------- Internals ------------------------------------
+  protected:
+
+    /// @param cfg any configuration
+    /// @return the shard where it is stored.
+    Shard& shard( const Configuration& cfg ) const
+    {
+      return myShards[ std::hash< Configuration >()( cfg ) % myNbShards ];
+    }
+
+    /// Looks for a configuration in the table.
+    /// @param cfg any configuration
+    /// @param prop the queried property
+    /// @return a pair (value,known)
+    std::pair< bool, bool > find( const Configuration& cfg, Property prop ) const;
+
+    /// Stores the property of a configuration.
+    /// @param cfg any configuration
+    /// @param prop the property
+    /// @param value the value of the property for \a cfg
+    void store( const Configuration& cfg, Property prop, bool value );
+
+    /// @param cfg1 any configuration
+    /// @param cfg2 any configuration
+    /// @return 'true' iff \a cfg1 is before \a cfg2 in lexicographic order.
+    static bool less( const Configuration& cfg1, const Configuration& cfg2 );
+
+    /// Precomputes the bit images of all the symmetries.
+    void computeSymmetries();
+
+  }; // end of class ConvexityConfigurationTable
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ConvexityConfigurationTable'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ConvexityConfigurationTable' to write.
+   * @return the output stream after the writing.
+   */
+  template < Dimension dim, int K >
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ConvexityConfigurationTable< dim, K > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "ConvexityConfigurationTable.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ConvexityConfigurationTable_h
+
+#undef ConvexityConfigurationTable_RECURSES
+#endif // else defined(ConvexityConfigurationTable_RECURSES)
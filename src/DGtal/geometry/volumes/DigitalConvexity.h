@@ -41,10 +41,14 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <algorithm>
 #include <list>
 #include <vector>
 #include <string>
+#include <array>
+#include <mutex>
 #include <unordered_set>
+#include <unordered_map>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Clone.h"
 #include "DGtal/topology/CCellularGridSpaceND.h"
@@ -93,6 +97,122 @@ namespace DGtal
 
     static const Dimension dimension = KSpace::dimension;
 
+    /// A thread-safe cache of the digital 0-convexity of point
+    /// ranges, which may be shared by several DigitalConvexity
+    /// objects (see DigitalConvexity::setCache). It avoids repeated
+    /// convex hull computations when the same sets are checked
+    /// several times, e.g. during greedy growth of fully convex sets,
+    /// where the dilated sets of the morphological characterization of
+    /// full convexity are also cached.
+    ///
+    /// Point ranges are stored sorted, whatever the order of their
+    /// points, and are looked up by their size and by two 64-bit
+    /// hashes. A stored result is only returned for a range made of
+    /// exactly the same points, so that hash collisions never give a
+    /// wrong answer.
+    class ConvexityCache {
+    public:
+      /// The key identifying a point range (size, hash1, hash2).
+      typedef std::array< DGtal::uint64_t, 3 > Key;
+
+      /// Constructor.
+      ConvexityCache() : myNb( 0 ), myHits( 0 ), myMisses( 0 ) {}
+      /// Copy constructor. Forbidden.
+      ConvexityCache( const ConvexityCache& other ) = delete;
+      /// Assignment. Forbidden.
+      ConvexityCache& operator=( const ConvexityCache& other ) = delete;
+
+      /// @param X any range of pairwise distinct points.
+      /// @return its key, which does not depend on the order of the points.
+      static Key key( const PointRange& X );
+
+      /// @param X any range of pairwise distinct points.
+      /// @return a pair (value,known) where 'known' is 'true' iff the
+      /// 0-convexity of the range \a X is stored.
+      std::pair< bool, bool > get( const PointRange& X );
+
+      /// Stores the 0-convexity of a point range.
+      /// @param X any range of pairwise distinct points.
+      /// @param value 'true' iff the range is digitally 0-convex.
+      void set( const PointRange& X, bool value );
+
+      /// Returns the stored 0-convexity of a point range, or computes
+      /// and stores it. The key and the sorted range are computed
+      /// once, and the lock is not held while computing.
+      /// @tparam Compute the type of a function object returning a bool.
+      /// @param X any range of pairwise distinct points.
+      /// @param compute a function object that returns 'true' iff the
+      /// range \a X is digitally 0-convex.
+      /// @return 'true' iff the range \a X is digitally 0-convex.
+      template < typename Compute >
+      bool getOrCompute( const PointRange& X, Compute compute );
+
+      /// @return the number of stored point ranges.
+      std::size_t size() const
+      {
+        std::lock_guard< std::mutex > lock( myMutex );
+        return myNb;
+      }
+      /// @return the number of queries that found their answer.
+      std::size_t hits() const
+      {
+        std::lock_guard< std::mutex > lock( myMutex );
+        return myHits;
+      }
+      /// @return the number of queries that did not find their answer.
+      std::size_t misses() const
+      {
+        std::lock_guard< std::mutex > lock( myMutex );
+        return myMisses;
+      }
+      /// Forgets all the stored point ranges.
+      void clear()
+      {
+        std::lock_guard< std::mutex > lock( myMutex );
+        myMap.clear();
+        myNb = myHits = myMisses = 0;
+      }
+
+    protected:
+      /// Hash function for keys.
+      struct KeyHash {
+        /// @param k any key
+        /// @return its hash value.
+        std::size_t operator()( const Key& k ) const
+        { return static_cast<std::size_t>( k[ 1 ] ^ ( k[ 0 ] * 0x9e3779b97f4a7c15ULL ) ); }
+      };
+      /// A stored point range, sorted, with its 0-convexity.
+      typedef std::pair< PointRange, bool > Entry;
+
+      /// @param X any range of points.
+      /// @return the sorted range of its points.
+      static PointRange sorted( const PointRange& X );
+
+      /// Looks up a sorted point range and updates the statistics. The
+      /// lock must be held.
+      /// @param k the key of the range.
+      /// @param Y the sorted range.
+      /// @return a pair (value,known) as get.
+      std::pair< bool, bool > find( const Key& k, const PointRange& Y );
+
+      /// Stores the 0-convexity of a sorted point range. The lock must
+      /// be held.
+      /// @param k the key of the range.
+      /// @param Y the sorted range, which is moved into the map.
+      /// @param value 'true' iff the range is digitally 0-convex.
+      void store( const Key& k, PointRange&& Y, bool value );
+
+      /// Protects the accesses to the map and to the statistics.
+      mutable std::mutex myMutex;
+      /// Associates to keys the ranges with this key and their 0-convexity.
+      std::unordered_map< Key, std::vector< Entry >, KeyHash > myMap;
+      /// Number of stored point ranges.
+      std::size_t myNb;
+      /// Number of successful queries.
+      std::size_t myHits;
+      /// Number of failed queries.
+      std::size_t myMisses;
+    };
 
     /// @name Standard services (construction, initialization, assignment)
     /// @{
@@ -136,6 +256,19 @@ namespace DGtal
     /// @return a const reference to the cellular grid space used by this object.
     const KSpace& space() const;
 
+    /// Makes this object use the given cache for 0-convexity checks
+    /// of point ranges (see is0Convex and isFullyConvex on point
+    /// ranges). Copies of this object share the same cache.
+    ///
+    /// @param cache a pointer to a cache that exists as long as this
+    /// object uses it, or nullptr to stop using a cache.
+    void setCache( ConvexityCache* cache )
+    { myCache = cache; }
+
+    /// @return a pointer to the cache used by this object, or nullptr.
+    ConvexityCache* cache() const
+    { return myCache; }
+
     /// @}
 
     // ----------------------- Simplex services --------------------------------------
@@ -384,6 +517,8 @@ namespace DGtal
     /// compromise between speed and precision (int64_t).
     ///
     /// @return 'true' iff \a X is fully digitally convex.
+    ///
+    /// @note Uses the cache given by setCache, if any.
     bool is0Convex( const PointRange& X, bool safe = false ) const;
     
     /// Tells if a given point range \a X is fully digitally
@@ -402,6 +537,11 @@ namespace DGtal
     /// compromise between speed and precision (int64_t).
     ///
     /// @return 'true' iff \a X is fully digitally convex.
+    ///
+    /// @note The 0-convexity checks of the dilations of \a X along
+    /// the same number of directions are independent, and are
+    /// performed in parallel when OpenMP is available. They use the
+    /// cache given by setCache, if any.
     bool isFullyConvex( const PointRange& X, bool convex0 = false,
                         bool safe = false ) const;
     
@@ -439,6 +579,9 @@ namespace DGtal
     /// it is not digitally d-1-convex then it is digitally d-convex
     /// (d := KSpace::dimension). Hence, we only check k-convexity for
     /// 1 <= k <= d-1.
+    ///
+    /// @note The cell covers of each dimension are computed in
+    /// parallel when OpenMP is available.
     bool isFullyConvex( const LatticePolytope& P ) const;
 
     /// Tells if a given polytope \a P is digitally k-subconvex of some
@@ -595,6 +738,8 @@ namespace DGtal
   protected:
     /// The cellular grid space where computations are done.
     KSpace myK;
+    /// The (shared) cache of 0-convexity checks, if any.
+    ConvexityCache* myCache = nullptr;
 
     // ------------------------- Private Datas --------------------------------
   private:
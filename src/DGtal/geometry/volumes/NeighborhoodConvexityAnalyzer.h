@@ -56,6 +56,7 @@
 #include "DGtal/topology/CCellularGridSpaceND.h"
 #include "DGtal/topology/KhalimskySpaceND.h"
 #include "DGtal/geometry/volumes/DigitalConvexity.h"
+#include "DGtal/geometry/volumes/ConvexityConfigurationTable.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -89,6 +90,24 @@ namespace DGtal
        configurations are not recomputed.
      - you can switch on/off the memoizer at object construction
        (e.g. it is useless in 2D).
+     - it can share a ConvexityConfigurationTable with other
+       analyzers (see setConfigurationTable), which memorizes
+       properties per class of symmetric configurations and can be
+       used by several threads.
+     - when the center moves to a neighbor point (see
+       translateCenter), its configuration is shifted and only the new
+       slice of the neighborhood is read.
+     - method scan analyzes all the points of a domain row by row,
+       translating the center, and processes slabs in parallel (with
+       OpenMP).
+
+     @code
+     typedef NeighborhoodConvexityAnalyzer< Z3i::KSpace, 1 > NCA;
+     NCA::ConfigurationTable table;
+     NCA nca( lo, hi );
+     nca.setConfigurationTable( &table );
+     auto noise = nca.scan( image, [] ( NCA& n ) { return n.isLikelyNoise(); } );
+     @endcode
   */
   template < typename TKSpace, int K >
   class NeighborhoodConvexityAnalyzer
@@ -114,6 +133,7 @@ namespace DGtal
 
     typedef std::bitset< functions::const_pow( 2*K+1, dimension ) > Configuration;
     typedef std::bitset< 9 > BasicConfiguration;
+    typedef ConvexityConfigurationTable< KSpace::dimension, K > ConfigurationTable;
 
     
     // ------------------------- Standard services --------------------------------
@@ -152,6 +172,7 @@ namespace DGtal
       myComputations = 0;
       myResults      = 0;
       computeBasicFullConvexityTable();
+      computeNeighborhoodTables();
       trace.info() << "Size=" << size() << " middle=" << middle << std::endl;
     }
 
@@ -170,6 +191,7 @@ namespace DGtal
       myComputations = 0;
       myResults      = 0;
       computeBasicFullConvexityTable();
+      computeNeighborhoodTables();
       trace.info() << "Size=" << size() << " middle=" << middle << std::endl;
     }
 
@@ -221,6 +243,22 @@ namespace DGtal
     template < typename PointPredicate >
     void setCenter( Point c, const PointPredicate& X );
 
+    /// Moves the center of the neighborhood to the next point along
+    /// axis \a k, i.e. `center() + e_k`, and updates the configuration
+    /// incrementally: it is shifted and only the \f$ (2K+1)^{d-1} \f$
+    /// new points are read in \a X. It is equivalent to `setCenter(
+    /// center() + e_k, X )`.
+    ///
+    /// @tparam PointPredicate an arbitrary model of concept::CPointPredicate
+    ///
+    /// @param k any dimension
+    ///
+    /// @param X the same predicate as the one given to the last call to setCenter.
+    ///
+    /// @pre `center() + e_k` lies in the domain.
+    template < typename PointPredicate >
+    void translateCenter( Dimension k, const PointPredicate& X );
+
     /// @return the current center.
     Point center() const
     {
@@ -233,6 +271,70 @@ namespace DGtal
       return myCfgX;
     }
 
+    /// Makes this object use the given table to memorize convexity
+    /// properties, instead of its memoizer. The table may be shared
+    /// by several analyzers, and by several threads.
+    ///
+    /// @param table a pointer to a table that exists as long as this
+    /// object uses it, or nullptr to stop using a table.
+    void setConfigurationTable( ConfigurationTable* table )
+    {
+      myTable = table;
+    }
+
+    /// @return a pointer to the table used to memorize convexity
+    /// properties, or nullptr if there is none.
+    ConfigurationTable* configurationTable() const
+    {
+      return myTable;
+    }
+
+    /// Analyzes every point of \a region, by placing the center of a
+    /// copy of this object at this point and by calling \a f on it.
+    /// The region is scanned row by row (along the first axis) with
+    /// translateCenter, and slabs of the region (along the last axis)
+    /// are processed in parallel when OpenMP is available, each thread
+    /// with its own copy of this object. Use a shared
+    /// ConvexityConfigurationTable (see setConfigurationTable) to
+    /// share memoized results between threads.
+    ///
+    /// @tparam PointPredicate an arbitrary model of concept::CPointPredicate
+    /// @tparam CenterPredicate the type of a function `bool( Self& )`.
+    ///
+    /// @param X a predicate associating a boolean to any point, which
+    /// corresponds to a characteristic function of a digital subset X
+    /// of the digital space. It must be thread-safe.
+    ///
+    /// @param f a function called for each center point, which
+    /// returns 'true' if this point must be part of the output, e.g.
+    /// `[] ( Self& n ) { return n.isLikelyNoise(); }`. It must be
+    /// thread-safe.
+    ///
+    /// @param region a domain included in the domain of this object.
+    ///
+    /// @return the points of the region for which \a f returned
+    /// 'true', in the order of the domain.
+    template < typename PointPredicate, typename CenterPredicate >
+    std::vector< Point > scan( const PointPredicate& X, CenterPredicate f,
+                               const Domain& region ) const;
+
+    /// Analyzes every point of the domain of this object.
+    /// @see scan( const PointPredicate&, CenterPredicate, const Domain& )
+    ///
+    /// @param X a predicate associating a boolean to any point, which
+    /// corresponds to a characteristic function of a digital subset X
+    /// of the digital space. It must be thread-safe.
+    ///
+    /// @param f a function called for each center point, which
+    /// returns 'true' if this point must be part of the output.
+    ///
+    /// @return the points of the domain for which \a f returned 'true'.
+    template < typename PointPredicate, typename CenterPredicate >
+    std::vector< Point > scan( const PointPredicate& X, CenterPredicate f ) const
+    {
+      return scan( X, f, myDomain );
+    }
+
     /// Tells if the current center belongs to the shape X
     bool isCenterInX() const
     {
@@ -291,8 +393,10 @@ namespace DGtal
         ? FullConvexity_X_with_center : FullConvexity_X_without_center;
       if ( myComputations & mask ) return bool( myResults & mask );
       bool ok;
+      if ( myTable != nullptr )
+        ok = tableProperty( false, with_center, ConfigurationTable::FullConvexity );
       // Check memoizer
-      if ( myMemoizer.isValid() )
+      else if ( myMemoizer.isValid() )
         {
           auto cfg = makeConfiguration( myCfgX, false, with_center );
           auto   p = myMemoizer.get( cfg );
@@ -358,8 +462,10 @@ namespace DGtal
         ? FullConvexity_CompX_with_center : FullConvexity_CompX_without_center;
       if ( myComputations & mask ) return bool( myResults & mask );
       bool ok;
+      if ( myTable != nullptr )
+        ok = tableProperty( true, with_center, ConfigurationTable::FullConvexity );
       // Check memoizer
-      if ( myMemoizer.isValid() )
+      else if ( myMemoizer.isValid() )
         {
           auto cfg = makeConfiguration( myCfgX, true, with_center );
           auto   p = myMemoizer.get( cfg );
@@ -424,8 +530,15 @@ namespace DGtal
     bool is0Convex( bool with_center )
     {
       int mask = with_center
-        ? FullConvexity_X_with_center : FullConvexity_X_without_center;
+        ? Convexity_X_with_center : Convexity_X_without_center;
       if ( myComputations & mask ) return bool( myResults & mask );
+      if ( myTable != nullptr )
+        {
+          bool ok = tableProperty( false, with_center, ConfigurationTable::ZeroConvexity );
+          myComputations |= mask;
+          if ( ok ) myResults |= mask;
+          return ok;
+        }
       // Need to compute full convexity property
       bool ok = checkBasicConfigurations0Convexity( false, with_center );
       if ( ok && false_positive )
@@ -447,8 +560,15 @@ namespace DGtal
     bool isComplementary0Convex( bool with_center )
     {
       int mask = with_center
-        ? FullConvexity_CompX_with_center : FullConvexity_CompX_without_center;
+        ? Convexity_CompX_with_center : Convexity_CompX_without_center;
       if ( myComputations & mask ) return bool( myResults & mask );
+      if ( myTable != nullptr )
+        {
+          bool ok = tableProperty( true, with_center, ConfigurationTable::ZeroConvexity );
+          myComputations |= mask;
+          if ( ok ) myResults |= mask;
+          return ok;
+        }
       // Need to compute full convexity property
       bool ok = checkBasicConfigurations0Convexity( true, with_center );
       if ( ok && false_positive )
@@ -516,6 +636,8 @@ namespace DGtal
     Size myNbInX;
     /// Stores the local configuration for X (without the center)
     Configuration myCfgX;
+    /// Stores the points of the neighborhood that lie in the domain.
+    Configuration myInsideCfg;
     /// Stores the basic local configurations associated to myCfgX, for speed-up
     std::vector< BasicConfiguration > myBasicCfgX;
 
@@ -523,6 +645,16 @@ namespace DGtal
     std::bitset< 512 > myBasicFullConvexityTable;
     /// Stores the 0-convexity property of the basic 3x3 neighborhood configurations
     std::bitset< 512 > myBasic0ConvexityTable;
+    /// The (shared) table memorizing convexity properties, if any.
+    ConfigurationTable* myTable = nullptr;
+    /// The vector from the center to each point of the neighborhood.
+    std::vector< Point > myOffsets;
+    /// For each axis k, the bits of the points of the neighborhood
+    /// whose k-th offset is K (the slice entering when translating along k).
+    std::vector< std::vector< Size > > mySliceBits;
+    /// For each axis k, the configuration of all the points of the
+    /// neighborhood except the ones of mySliceBits[ k ].
+    std::vector< Configuration > mySliceMasks;
     
     /// Enum types indicating the possible type of local computations.
     enum Computation {
@@ -549,6 +681,21 @@ namespace DGtal
     /// it is fully convex.
     void computeBasicFullConvexityTable();
 
+    /// Precomputes the offsets and slices of the neighborhood used
+    /// by translateCenter.
+    void computeNeighborhoodTables();
+
+    /// Computes a convexity property of the current configuration,
+    /// looking first in the configuration table and storing the
+    /// result afterwards.
+    ///
+    /// @param compX when 'true', complements the configuration.
+    /// @param with_center when 'true', makes the center point part of the configuration
+    /// @param prop the property (full convexity or 0-convexity)
+    /// @return 'true' iff the property holds.
+    bool tableProperty( bool compX, bool with_center,
+                        typename ConfigurationTable::Property prop );
+
     /// For the current configuration, checks if all the 2D slices of
     /// the configuration are fully convex (for speed-up). They must be
     /// all true for the global nD configuration to be fully convex.
@@ -45,6 +45,7 @@
 #include <string>
 #include <limits>
 #include <unordered_set>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Clone.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
@@ -89,13 +90,18 @@ namespace DGtal
 
     /// This structure is a state machine that computes shortest paths in a digital
     /// set. Internally, it references a TangencyComputer.
+    ///
+    /// It is also a workspace: once constructed, `clear()` only resets
+    /// the points touched by the previous computation, so that the same
+    /// object can be reused for many successive computations without
+    /// reallocating its arrays.
     struct ShortestPaths {
       /// Type used for Dijkstra's algorithm queue (point, ancestor, distance).
       typedef std::tuple< Index, Index, double > Node;
 
       /// Allows to compare two nodes (closest is popped first) by
       /// modeling a `greater than` relation (which is the relation
-      /// used for `std::priority_queue` when you wish to have the
+      /// used for `std::push_heap` when you wish to have the
       /// smallest one outputed first).
       struct Comparator {
         /// @param p1 the first node
@@ -147,7 +153,8 @@ namespace DGtal
       ShortestPaths( ConstAlias< TangencyComputer > tgcy_computer,
                      double secure = sqrt( KSpace::dimension ) )
         : myTgcyComputer( &tgcy_computer ),
-          mySecure( std::max( secure, 0.0 ) )
+          mySecure( std::max( secure, 0.0 ) ),
+          myMark( 0 )
       {
         clear();
       }
@@ -166,14 +173,32 @@ namespace DGtal
       
       /// Clears the object and prepares it for a shortest path
       /// computation.
+      ///
+      /// @note Takes O(n) time complexity the first time (or if the
+      /// tangency computer has changed size), then O(k) time complexity,
+      /// where k is the number of points touched by the previous
+      /// computation.
       void clear()
       {
-        const int nb = size();
-        myAncestor = std::vector< Index > ( nb, nb );
-        myDistance = std::vector< double >( nb, std::numeric_limits<double>::infinity() );
-        myVisited  = std::vector< bool >  ( nb, false );
-        myQ        = std::priority_queue< Node, std::vector< Node >, Comparator >();
-  }
+        const Index nb = size();
+        if ( myAncestor.size() != nb )
+          {
+            myAncestor = std::vector< Index > ( nb, nb );
+            myDistance = std::vector< double >( nb, infinity() );
+            myVisited  = std::vector< bool >  ( nb, false );
+            myMarks    = std::vector< unsigned int >( nb, 0 );
+            myMark     = 0;
+          }
+        else
+          for ( auto i : myTouched )
+            {
+              myAncestor[ i ] = nb;
+              myDistance[ i ] = infinity();
+              myVisited [ i ] = false;
+            }
+        myTouched.clear();
+        myQ.clear();
+      }
 
       /// Adds the point with index \a i as a source point
       /// @param[in] i any valid index
@@ -181,7 +206,8 @@ namespace DGtal
       void init( Index i )
       {
         ASSERT( 0 <= i && i < size() );
-        myQ.push( std::make_tuple( i, i, 0.0 ) );
+        pushNode( std::make_tuple( i, i, 0.0 ) );
+        touch( i );
         myAncestor[ i ] = i;
         myDistance[ i ] = 0.0;
         myVisited [ i ] = true;
@@ -200,10 +226,11 @@ namespace DGtal
           {
             const auto i = *it;
             ASSERT( 0 <= i && i < size() );
-            myQ.push( std::make_tuple( i, i, 0.0 ) );
+            pushNode( std::make_tuple( i, i, 0.0 ) );
           }
-        const auto elem = myQ.top();
+        const auto elem = myQ.front();
         const auto i    = std::get<0>( elem );
+        touch( i );
         myAncestor[ i ] = i;
         myDistance[ i ] = 0.0;
         myVisited [ i ] = true;
@@ -225,7 +252,7 @@ namespace DGtal
       const Node& current() const
       {
         ASSERT( ! finished() );
-        return myQ.top();
+        return myQ.front();
       }
 
       /// Goes to the next point in the bft.
@@ -340,11 +367,48 @@ namespace DGtal
       std::vector< double >   myDistance;
       /// Remembers for each point if it is already visited.
       std::vector< bool >     myVisited;
-      /// The queue of points being currently processed.
-      std::priority_queue< Node, std::vector< Node >, Comparator > myQ;
+      /// The queue of points being currently processed, organized as
+      /// a binary heap with Comparator (its capacity is kept by `clear()`).
+      std::vector< Node >     myQ;
+      /// The indices of the points whose ancestor or distance have
+      /// been modified since the last `clear()`.
+      std::vector< Index >    myTouched;
+      /// Marks of the points met by the current breadth-first
+      /// traversal of `getCotangentPoints`, which are equal to \ref myMark.
+      std::vector< unsigned int > myMarks;
+      /// The mark of the current breadth-first traversal.
+      unsigned int            myMark;
+      /// The queue of the breadth-first traversal of `getCotangentPoints`.
+      std::vector< Index >    myBFTQueue;
+      /// The cotangent points computed by `getCotangentPoints`.
+      std::vector< Index >    myNeighbors;
 
     protected:
 
+      /// Pushes a node in the queue.
+      /// @param n any node
+      void pushNode( const Node& n )
+      {
+        myQ.push_back( n );
+        std::push_heap( myQ.begin(), myQ.end(), Comparator() );
+      }
+
+      /// Removes the node on top of the queue.
+      void popNode()
+      {
+        std::pop_heap( myQ.begin(), myQ.end(), Comparator() );
+        myQ.pop_back();
+      }
+
+      /// Remembers that point \a i is modified by the computation, so
+      /// that `clear()` resets it.
+      /// @param[in] i any valid index
+      void touch( Index i )
+      {
+        if ( ( myAncestor[ i ] == size() ) && ( myDistance[ i ] == infinity() ) )
+          myTouched.push_back( i );
+      }
+
       /// Updates the queue with the cotangent points of the point given in parameter.
       ///
       /// @param current the index of the point where we determine its
@@ -356,9 +420,10 @@ namespace DGtal
       ///
       /// @param[in] i the index of a point
       ///
-      /// @return the indices of the other points of the shape that are cotangent to \a a.
-      std::vector< Index >
-      getCotangentPoints( Index i ) const;
+      /// @param[out] R the indices of the other points of the shape
+      /// that are cotangent to the point \a i.
+      void
+      getCotangentPoints( Index i, std::vector< Index >& R );
 
     };
 
@@ -482,6 +547,48 @@ namespace DGtal
     std::vector< Index >
     getCotangentPoints( const Point& a,
                         const std::vector< bool > & to_avoid ) const;
+
+    /// Computes and stores the cotangent points of the given points,
+    /// as given by the breadth-first traversal used by shortest
+    /// paths computations (but without any pruning). Afterwards,
+    /// ShortestPaths objects use these neighborhoods instead of
+    /// recomputing them at each expansion. Computations are done in
+    /// parallel when OpenMP is available.
+    ///
+    /// @param[in] indices the indices of the points whose cotangent
+    /// points are cached.
+    ///
+    /// @note With cached neighborhoods, the `secure` parameter of
+    /// shortest paths no longer prunes the traversal, hence shortest
+    /// paths are always exact.
+    void cacheCotangentPoints( const std::vector< Index >& indices );
+
+    /// Computes and stores the cotangent points of all the points.
+    /// @see cacheCotangentPoints( const std::vector< Index >& )
+    void cacheCotangentPoints();
+
+    /// Forgets all the cached cotangent points.
+    void clearCotangentCache()
+    {
+      myCotangentCache.clear();
+      myIsCotangentCached.clear();
+    }
+
+    /// @param[in] i any valid point index
+    /// @return 'true' iff the cotangent points of point \a i are cached.
+    bool isCotangentCached( Index i ) const
+    {
+      return ( i < myIsCotangentCached.size() ) && myIsCotangentCached[ i ];
+    }
+
+    /// @param[in] i any valid point index
+    /// @return the cached cotangent points of point \a i.
+    /// @pre `isCotangentCached( i )`
+    const std::vector< Index >& cachedCotangentPoints( Index i ) const
+    {
+      ASSERT( isCotangentCached( i ) );
+      return myCotangentCache[ i ];
+    }
     
     /// @}
     
@@ -568,6 +675,28 @@ namespace DGtal
     shortestPath( Index source, Index target,
                   double secure = sqrt( KSpace::dimension ),
                   bool verbose = false ) const;
+
+    /// Computes the geodesic distances from each one of the given
+    /// sources to the points of the shape. Sources are processed in
+    /// parallel when OpenMP is available, each thread reusing its own
+    /// ShortestPaths object.
+    ///
+    /// @param[in] sources the indices of the `n` source points.
+    ///
+    /// @param secure This value is used to prune vertices in the
+    /// bft (see makeShortestPaths).
+    ///
+    /// @param[in] max_distance the traversal from a source stops
+    /// when this distance is reached.
+    ///
+    /// @return the `n` distance fields, i.e. the distance from the
+    /// `k`-th source to point `i` is `result[ k ][ i ]`. Points that are
+    /// unreachable or further than \a max_distance are at distance
+    /// ShortestPaths::infinity().
+    std::vector< std::vector< double > >
+    geodesicDistances( const std::vector< Index >& sources,
+                       double secure = sqrt( KSpace::dimension ),
+                       double max_distance = std::numeric_limits<double>::infinity() ) const;
     
     /// @}
     
@@ -589,6 +718,11 @@ namespace DGtal
     CellGeometry< KSpace > myCellCover;
     /// A map giving for each point its index.
     std::unordered_map< Point, Index > myPt2Index;
+    /// The cached cotangent points of each point (if computed).
+    std::vector< std::vector< Index > > myCotangentCache;
+    /// Tells for each point if its cotangent points are cached (char
+    /// instead of bool so that threads may write distinct entries).
+    std::vector< char > myIsCotangentCached;
     
     // ------------------------- Private Datas --------------------------------
   private:
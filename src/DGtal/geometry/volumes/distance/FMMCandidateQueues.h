@@ -0,0 +1,401 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FMMCandidateQueues.h
+ *
+ * @date 2026/10/18
+ *
+ * @brief Priority queues of candidate points (the front) for the Fast
+ * Marching Method
+ *
+ * This file is part of the DGtal library.
+ *
+ */
+
+#if defined(FMMCandidateQueues_RECURSES)
+#error Recursive header files inclusion detected in FMMCandidateQueues.h
+#else // defined(FMMCandidateQueues_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FMMCandidateQueues_RECURSES
+
+#if !defined FMMCandidateQueues_h
+/** Prevents repeated inclusion of headers. */
+#define FMMCandidateQueues_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cmath>
+#include <array>
+#include <limits>
+#include <set>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  namespace detail
+  {
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PointValueCompare
+  /**
+   * Description of template class 'PointValueCompare' <p>
+   * \brief Aim: Small binary predicate to order candidates points
+   * according to their (absolute) distance value.
+   *
+   * @tparam T model of pair Point-Value
+   */
+    template<typename T>
+    class PointValueCompare {
+    public:
+      /**
+       * Comparison function
+       *
+       * @param a an object of type T
+       * @param b another object of type T
+       *
+       * @return true if a < b but false otherwise
+       */
+      bool operator()(const T& a, const T& b) const
+      {
+	if ( std::abs(a.second) == std::abs(b.second) )
+	  { //point comparison
+	    return (a.first < b.first);
+	  }
+	else //distance comparison
+	  //(in absolute value in order to deal with
+	  //signed distance values)
+	  return ( std::abs(a.second) < std::abs(b.second) );
+      }
+    };
+  }
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class STLSetCandidateQueue
+  /**
+   * Description of template class 'STLSetCandidateQueue' <p>
+   * \brief Aim: Set of candidate points of the Fast Marching Method,
+   * ordered by absolute distance value, stored in a STL set of pairs
+   * (point, tentative value).
+   *
+   * A point may be pushed several times: all its pairs are kept and
+   * the ones that are extracted after the first one are discarded by
+   * FMM since the point is already accepted.
+   *
+   * This is the historical and default front of FMM: each insertion
+   * allocates a node, but the memory footprint is proportional to
+   * the front.
+   *
+   * @tparam TPoint a model of point
+   * @tparam TValue a signed number type for distance values
+   *
+   * @see FMM, IndexedHeapCandidateQueue, BucketCandidateQueue
+   */
+  template <typename TPoint, typename TValue>
+  class STLSetCandidateQueue
+  {
+  public:
+    typedef TPoint Point;
+    typedef TValue Value;
+    typedef std::pair<Point, Value> PointValue;
+    typedef std::size_t Size;
+
+    /// Clears the queue (the box of candidate points is not needed).
+    void init( const Point& /*lowerBound*/, const Point& /*upperBound*/ ) { clear(); }
+    /// Clears the queue.
+    void clear() { mySet.clear(); }
+    /// @return 'true' iff there is no candidate.
+    bool empty() const { return mySet.empty(); }
+    /// @return the number of stored pairs.
+    Size size() const { return mySet.size(); }
+    /**
+     * Inserts a new candidate.
+     * @param aPoint any point
+     * @param aValue its tentative distance value
+     * @pre \a aValue is finite
+     */
+    void push( const Point& aPoint, const Value& aValue )
+    { mySet.insert( PointValue( aPoint, aValue ) ); }
+    /// @return the candidate of smallest absolute value.
+    /// @pre not empty
+    const PointValue& top() const { return *mySet.begin(); }
+    /// Removes the candidate of smallest absolute value.
+    /// @pre not empty
+    void pop() { mySet.erase( mySet.begin() ); }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const
+    { out << "[STLSetCandidateQueue #" << size() << "]"; }
+    /// @return 'true'
+    bool isValid() const { return true; }
+
+  private:
+    /// The ordered set of pairs (point, tentative value)
+    std::set< PointValue, detail::PointValueCompare<PointValue> > mySet;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class IndexedHeapCandidateQueue
+  /**
+   * Description of template class 'IndexedHeapCandidateQueue' <p>
+   * \brief Aim: Set of candidate points of the Fast Marching Method,
+   * ordered by absolute distance value, stored in an array-based
+   * d-ary heap with decrease-key.
+   *
+   * Each point is stored at most once: the position of each point
+   * in the heap is memorized, so that pushing again a point only
+   * updates its value if the new one is smaller (in absolute value),
+   * and then sifts it up. Candidates are thus extracted in the very
+   * same order as with STLSetCandidateQueue, without any per
+   * insertion allocation in the heap itself.
+   *
+   * Positions are stored in an array indexed by the linearized
+   * position of points in the box given to init(), typically the
+   * domain of the distance image, so that sifts update positions
+   * without hashing. This array costs one Size per point of the box,
+   * whatever the size of the front: for sparse distance images over
+   * huge domains or small computed regions, STLSetCandidateQueue
+   * (the default of FMM) should be preferred.
+   *
+   * @tparam TPoint a model of point
+   * @tparam TValue a signed number type for distance values
+   * @tparam arity the number of children of each node (4 by default,
+   * which is more cache friendly than a binary heap).
+   *
+   * @see FMM, STLSetCandidateQueue, BucketCandidateQueue
+   */
+  template <typename TPoint, typename TValue, unsigned int arity = 4>
+  class IndexedHeapCandidateQueue
+  {
+    BOOST_STATIC_ASSERT(( arity >= 2 ));
+  public:
+    typedef TPoint Point;
+    typedef TValue Value;
+    typedef std::pair<Point, Value> PointValue;
+    typedef std::size_t Size;
+    typedef typename Point::Dimension Dimension;
+
+    /**
+     * Prepares the queue for candidates lying in a box and clears it.
+     * @param lowerBound the lower bound of the box.
+     * @param upperBound the upper bound of the box.
+     */
+    void init( const Point& lowerBound, const Point& upperBound );
+    /// Clears the queue.
+    void clear();
+    /// @return 'true' iff there is no candidate.
+    bool empty() const { return myHeap.empty(); }
+    /// @return the number of candidates.
+    Size size() const { return myHeap.size(); }
+    /**
+     * Inserts a new candidate, or decreases the value of an
+     * already stored candidate if \a aValue is smaller (in absolute
+     * value) than its current value.
+     * @param aPoint any point of the box given to init()
+     * @param aValue its tentative distance value
+     */
+    void push( const Point& aPoint, const Value& aValue );
+    /// @return the candidate of smallest absolute value.
+    /// @pre not empty
+    const PointValue& top() const { return myHeap.front(); }
+    /// Removes the candidate of smallest absolute value.
+    /// @pre not empty
+    void pop();
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+    /**
+     * Checks the heap property and the positions.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+  private:
+    /// Position stored for the points that are not in the heap
+    static const Size NOT_IN_HEAP = std::numeric_limits<Size>::max();
+
+    /// Heap of pairs (point, tentative value)
+    std::vector< PointValue > myHeap;
+    /// Position in the heap of each point of the box (or NOT_IN_HEAP)
+    std::vector< Size > myPositions;
+    /// Lower bound of the box of candidate points
+    Point myLowerBound;
+    /// Offsets of a unit move along each axis in myPositions
+    std::array< Size, Point::dimension > myStrides;
+
+    /// @return the index of the point \a aPoint in myPositions.
+    Size index( const Point& aPoint ) const;
+    /// @return 'true' if a should be extracted before b
+    static bool less( const PointValue& a, const PointValue& b )
+    { return detail::PointValueCompare<PointValue>()( a, b ); }
+    /// Moves up the element at index \a i to restore the heap property.
+    void siftUp( Size i );
+    /// Moves down the element at index \a i to restore the heap property.
+    void siftDown( Size i );
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BucketCandidateQueue
+  /**
+   * Description of template class 'BucketCandidateQueue' <p>
+   * \brief Aim: Set of candidate points of the Fast Marching Method,
+   * stored in an untidy priority queue made of buckets of width
+   * 1/bucketsPerUnit (Yatziv, Bartesaghi, Sapiro, 2006).
+   *
+   * Insertion and extraction are in O(1), but candidates are only
+   * sorted up to the bucket width: the first candidate of the lowest
+   * non empty bucket is extracted, and a candidate whose value is
+   * lower than the current bucket is put in the current bucket. The
+   * error on distance values is thus bounded by the bucket width.
+   * Like STLSetCandidateQueue, a point may be pushed several times.
+   *
+   * Buckets are stored in a circular array which grows if needed, up
+   * to maxBuckets buckets: a candidate farther than that from the
+   * current bucket is put in the last bucket of the array (its
+   * distance value is then only approximated by excess). Distance
+   * values must be finite.
+   *
+   * @tparam TPoint a model of point
+   * @tparam TValue a signed number type for distance values
+   * @tparam bucketsPerUnit the number of buckets per unit of distance
+   *
+   * @see FMM, STLSetCandidateQueue, IndexedHeapCandidateQueue
+   */
+  template <typename TPoint, typename TValue, unsigned int bucketsPerUnit = 16>
+  class BucketCandidateQueue
+  {
+    BOOST_STATIC_ASSERT(( bucketsPerUnit >= 1 ));
+  public:
+    typedef TPoint Point;
+    typedef TValue Value;
+    typedef std::pair<Point, Value> PointValue;
+    typedef std::size_t Size;
+
+    /// Maximal number of buckets of the circular array.
+    static const Size maxBuckets = Size( 1 ) << 20;
+
+    /// Default constructor. The queue is empty.
+    BucketCandidateQueue();
+    /// Clears the queue (the box of candidate points is not needed).
+    void init( const Point& /*lowerBound*/, const Point& /*upperBound*/ ) { clear(); }
+    /// Clears the queue.
+    void clear();
+    /// @return 'true' iff there is no candidate.
+    bool empty() const { return mySize == 0; }
+    /// @return the number of stored pairs.
+    Size size() const { return mySize; }
+    /**
+     * Inserts a new candidate.
+     * @param aPoint any point
+     * @param aValue its tentative distance value
+     * @pre \a aValue is finite
+     */
+    void push( const Point& aPoint, const Value& aValue );
+    /// @return a candidate of the lowest non empty bucket.
+    /// @pre not empty
+    const PointValue& top() const;
+    /// Removes the candidate returned by top().
+    /// @pre not empty
+    void pop();
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+  private:
+    /// Circular array of buckets (its size is a power of two).
+    std::vector< std::vector< PointValue > > myBuckets;
+    /// Absolute index of the lowest bucket that may be non empty.
+    mutable Size myFirst;
+    /// Number of stored pairs.
+    Size mySize;
+
+    /// @return the absolute index of the bucket of value \a aValue,
+    /// clamped so as to never overflow.
+    /// @pre \a aValue is finite
+    static Size bucketIndex( const Value& aValue );
+    /// Moves myFirst to the lowest non empty bucket.
+    /// @pre not empty
+    void skipEmptyBuckets() const;
+    /// Doubles the number of buckets, keeping absolute indices.
+    void grow();
+  };
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'STLSetCandidateQueue'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'STLSetCandidateQueue' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPoint, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const STLSetCandidateQueue<TPoint, TValue> & object );
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'IndexedHeapCandidateQueue'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'IndexedHeapCandidateQueue' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPoint, typename TValue, unsigned int arity>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const IndexedHeapCandidateQueue<TPoint, TValue, arity> & object );
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BucketCandidateQueue'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BucketCandidateQueue' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPoint, typename TValue, unsigned int bucketsPerUnit>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const BucketCandidateQueue<TPoint, TValue, bucketsPerUnit> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/FMMCandidateQueues.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FMMCandidateQueues_h
+
+#undef FMMCandidateQueues_RECURSES
+#endif // else defined(FMMCandidateQueues_RECURSES)
@@ -0,0 +1,303 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FastSweeping.h
+ *
+ * @date 2026/10/18
+ *
+ * @brief Fast Sweeping Method for distance transforms, parallel
+ * alternative to the Fast Marching Method.
+ *
+ * This file is part of the DGtal library.
+ *
+ */
+
+#if defined(FastSweeping_RECURSES)
+#error Recursive header files inclusion detected in FastSweeping.h
+#else // defined(FastSweeping_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FastSweeping_RECURSES
+
+#if !defined FastSweeping_h
+/** Prevents repeated inclusion of headers. */
+#define FastSweeping_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <limits>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/CPointFunctor.h"
+#include "DGtal/geometry/volumes/distance/FMMPointFunctors.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FastSweeping
+  /**
+   * Description of template class 'FastSweeping' <p>
+   * \brief Aim: Fast Sweeping Method (Zhao, 2005) for nd distance
+   * transforms, computing the same distance values as FMM with the
+   * same local update rules (see FMMPointFunctors), but in parallel.
+   *
+   * Like FMM, the computation starts from a set of points whose
+   * (signed) distance values are known, and which are left
+   * unchanged. Then, the whole domain of the image is swept in the
+   * \f$ 2^d \f$ diagonal directions, in Gauss-Seidel fashion: the
+   * value of each point of the domain that satisfies the point
+   * predicate and has a known neighbor is computed by the point
+   * functor and kept if it is smaller (in absolute value) than its
+   * current value. Sweeps are repeated until no value changes.
+   *
+   * Each sweep processes the domain hyperplane by hyperplane
+   * (Detrixhe, Gibou, Min, 2013): the points of an hyperplane
+   * orthogonal to the sweep direction only depend on the two
+   * neighboring hyperplanes, hence they are processed in parallel
+   * (with OpenMP) and the result is exactly the one of the sequential
+   * sweep, whatever the number of threads.
+   *
+   * Contrary to FMM, whose cost depends on the number of accepted
+   * points, the cost of a sweep is proportional to the size of the
+   * domain: this method is thus interesting for large narrow bands
+   * that fill a large part of their bounding box.
+   *
+   * @note Within an hyperplane, values of distinct points are written
+   * concurrently into the image, which must support it (like
+   * ImageContainerBySTLVector). The set of points with known values is
+   * only read concurrently and updated sequentially.
+   *
+   * @tparam TImage  any model of CImage whose domain is an HyperRectDomain
+   * @tparam TSet  any model of CDigitalSet
+   * @tparam TPointPredicate  any model of concepts::CPointPredicate,
+   * used to bound the computation within a domain
+   * @tparam TPointFunctor  any model of CPointFunctor, constructible from
+   * an image and a set like the FMM point functors, used to compute the
+   * new distance values.
+   *
+   * @see FMM
+   * @see testFastSweeping.cpp
+   */
+  template <typename TImage, typename TSet, typename TPointPredicate,
+	    typename TPointFunctor = L2FirstOrderLocalDistance<TImage,TSet> >
+  class FastSweeping
+  {
+
+    // ----------------------- Types ------------------------------
+  public:
+
+    //concept assert
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImage> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet<TSet> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate<TPointPredicate> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointFunctor<TPointFunctor> ));
+
+    typedef TImage Image;
+    typedef TSet AcceptedPointSet;
+    typedef TPointPredicate PointPredicate;
+    typedef typename Image::Domain Domain;
+
+    //points
+    typedef typename Image::Point Point;
+    BOOST_STATIC_ASSERT(( boost::is_same< Point, typename AcceptedPointSet::Point >::value ));
+    BOOST_STATIC_ASSERT(( boost::is_same< Point, typename PointPredicate::Point >::value ));
+
+    //dimension
+    typedef typename Point::Dimension Dimension;
+    static const Dimension dimension = Point::dimension;
+
+    //distance
+    typedef TPointFunctor PointFunctor;
+    typedef typename PointFunctor::Value Value;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param aImg the distance image, whose values at the points of
+     * @a aSet are known.
+     * @param aSet the set of points whose distance value is known.
+     * @param aPointPredicate a point predicate that returns 'true'
+     * inside the domain where the distance transform is performed.
+     * @param aValueThreshold distance values are computed only if
+     * smaller (in absolute value) than this threshold.
+     */
+    FastSweeping( Image& aImg, AcceptedPointSet& aSet,
+                  ConstAlias<PointPredicate> aPointPredicate,
+                  const Value& aValueThreshold = std::numeric_limits<Value>::max() );
+
+    /**
+     * Destructor.
+     */
+    ~FastSweeping() = default;
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    FastSweeping ( const FastSweeping & other ) = delete;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    FastSweeping & operator= ( const FastSweeping & other ) = delete;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Computes the distance values by sweeping the domain in all
+     * diagonal directions, until no value changes.
+     *
+     * @param aMaxNbIterations the maximal number of iterations (each
+     * iteration is made of \f$ 2^d \f$ sweeps).
+     *
+     * @return the number of performed iterations.
+     */
+    unsigned int compute( unsigned int aMaxNbIterations = 16 );
+
+    /**
+     * Performs one sweep of the domain.
+     *
+     * @param aDirection the sweep direction, given by the signs of its
+     * components.
+     *
+     * @return 'true' if some distance value has changed, 'false' otherwise.
+     */
+    bool sweep( const Point& aDirection );
+
+    /**
+     * Minimal distance value in the set of accepted points.
+     * @return minimal distance value.
+     */
+    Value min() const;
+
+    /**
+     * Maximal distance value in the set of accepted points.
+     * @return maximal distance value
+     */
+    Value max() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Reference on the image
+    Image& myImage;
+    /// Reference on the set of points whose distance value is known
+    AcceptedPointSet& myAcceptedPoints;
+    /// Constant reference on the point predicate bounding the computation
+    const PointPredicate& myPointPredicate;
+    /// Value threshold above which values are not computed
+    Value myValueThreshold;
+    /// Lower bound of the domain
+    Point myLowerBound;
+    /// Upper bound of the domain
+    Point myUpperBound;
+    /// Flags (in the linearized domain) of the initial points, whose
+    /// values are never modified.
+    std::vector<char> myFixedPoints;
+    /// Number of performed sweeps.
+    unsigned int myNbSweeps;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param aPoint any point of the domain
+     * @return its index in the linearized domain.
+     */
+    std::size_t index( const Point& aPoint ) const;
+
+    /**
+     * Collects the points of the domain lying on an hyperplane
+     * orthogonal to the sweep direction.
+     *
+     * @param aDirection the sweep direction
+     * @param aLevel the index of the hyperplane, i.e. the L1 distance
+     * to the corner of the domain where the sweep starts.
+     * @param aPoints (returns) the points of the hyperplane.
+     */
+    void hyperplanePoints( const Point& aDirection, long aLevel,
+                           std::vector<Point>& aPoints ) const;
+
+    /**
+     * Computes a new value at some point.
+     *
+     * @param aFunctor the point functor used by this thread
+     * @param aPoint any point of the domain
+     * @param aValue (returns) the new value
+     *
+     * @return 'true' if @a aPoint gets a new value, smaller than its
+     * previous one (if any).
+     */
+    bool updateValue( PointFunctor& aFunctor, const Point& aPoint,
+                      Value& aValue ) const;
+
+  }; // end of class FastSweeping
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FastSweeping'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FastSweeping' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImage, typename TSet, typename TPointPredicate, typename TPointFunctor >
+  std::ostream&
+  operator<< ( std::ostream & out, const FastSweeping<TImage, TSet, TPointPredicate, TPointFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/FastSweeping.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FastSweeping_h
+
+#undef FastSweeping_RECURSES
+#endif // else defined(FastSweeping_RECURSES)
@@ -48,6 +48,7 @@
 #include <array>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CountedPtr.h"
+#include "DGtal/base/Instrumentation.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/images/CImage.h"
 #include "DGtal/kernel/CPointPredicate.h"
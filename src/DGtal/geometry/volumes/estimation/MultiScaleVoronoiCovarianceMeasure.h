@@ -0,0 +1,303 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MultiScaleVoronoiCovarianceMeasure.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module MultiScaleVoronoiCovarianceMeasure.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MultiScaleVoronoiCovarianceMeasure_RECURSES)
+#error Recursive header files inclusion detected in MultiScaleVoronoiCovarianceMeasure.h
+#else // defined(MultiScaleVoronoiCovarianceMeasure_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MultiScaleVoronoiCovarianceMeasure_RECURSES
+
+#if !defined MultiScaleVoronoiCovarianceMeasure_h
+/** Prevents repeated inclusion of headers. */
+#define MultiScaleVoronoiCovarianceMeasure_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Instrumentation.h"
+#include "DGtal/kernel/PointHashFunctions.h"
+#include "DGtal/geometry/volumes/estimation/VoronoiCovarianceMeasure.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MultiScaleVoronoiCovarianceMeasure
+  /**
+   * Description of template class 'MultiScaleVoronoiCovarianceMeasure' <p>
+   * \brief Aim: This class precomputes the Voronoi Covariance
+   * Measure of a set of points for several offset radii R at
+   * once. The Voronoi map and the proximity structure are computed
+   * only once (for the biggest offset radius and the biggest kernel
+   * radius), then a single traversal of the domain accumulates the
+   * Voronoi covariance matrices of all scales.
+   *
+   * Points are indexed from 0 to `size()-1` in the order they were
+   * given to \ref init (duplicates are removed), and covariance
+   * matrices are stored in flat vectors indexed by point indices,
+   * which makes this class suitable for parallel queries.
+   *
+   * The results for scale \a k are exactly the ones of a
+   * VoronoiCovarianceMeasure built with parameters `R(k)` and `r()`.
+   *
+   * @see VoronoiCovarianceMeasure
+   *
+   * @tparam TSpace type of Digital Space (model of CSpace).
+   *
+   * @tparam TSeparableMetric a model of CSeparableMetric used for
+   * computing the Voronoi map (e.g. Euclidean metric is
+   * DGtal::ExactPredicateLpSeparableMetric<TSpace, 2> )
+   */
+  template <typename TSpace, typename TSeparableMetric>
+  class MultiScaleVoronoiCovarianceMeasure
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace< TSpace > ));
+    BOOST_CONCEPT_ASSERT(( concepts::CSeparableMetric<TSeparableMetric> ));
+
+  public:
+    typedef TSpace Space;                         ///< the type of digital space
+    typedef TSeparableMetric Metric;              ///< the type of metric
+    typedef VoronoiCovarianceMeasure<Space,Metric> VCM; ///< the single scale VCM
+    typedef typename Space::Point Point;          ///< the type of digital point
+    typedef typename Space::Size Size;            ///< the type for counting elements
+    typedef typename Space::Integer Integer;      ///< the type of each digital point coordinate, some integral type
+    typedef typename VCM::Domain Domain;          ///< the type of rectangular domain of the VCM.
+    typedef typename VCM::CharacteristicSet CharacteristicSet; ///< the type of a binary image that is the characteristic function of K.
+    typedef typename VCM::ProximityStructure ProximityStructure; ///< the structure used for proximity queries.
+    typedef typename VCM::CharacteristicSetPredicate CharacteristicSetPredicate; ///< the predicate "is in K"
+    typedef typename VCM::NotPredicate NotPredicate; ///< the type of the point predicate used by the voronoi map.
+    typedef typename VCM::Voronoi Voronoi;        ///< the type of the Voronoi map.
+    typedef typename VCM::Scalar Scalar;          ///< the type for "real" numbers.
+    typedef typename VCM::MatrixNN MatrixNN;      ///< the type for nxn matrix of real numbers.
+    typedef typename VCM::VectorN VectorN;        ///< the type for N-vector of real numbers
+    typedef std::size_t Index;                    ///< the type for indexing points and scales
+    typedef std::vector<Point> PointContainer;    ///< the list of points
+    typedef std::unordered_map<Point,Index> Point2Index; ///< Associates an index to points.
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param Rs the offset radii for the set of points. Voronoi cells
+     * are intersected with each of these offsets. The unit
+     * corresponds to a step in the digital space. They need not be
+     * sorted.
+     *
+     * @param _r (an upper bound of) the radius of the support of all
+     * forthcoming kernel functions (\f$ \chi_r \f$), at any scale.
+     *
+     * @param aMetric an instance of the metric.
+     * @param verbose if 'true' displays information on ongoing computation.
+     */
+    MultiScaleVoronoiCovarianceMeasure( const std::vector<Scalar>& Rs, Scalar _r,
+                                        Metric aMetric = Metric(), bool verbose = false );
+
+    /**
+     * Destructor.
+     */
+    ~MultiScaleVoronoiCovarianceMeasure();
+
+    /// @return the number of scales, i.e. the number of offset radii.
+    Index nbScales() const;
+    /// @param k any scale index in 0..nbScales()-1.
+    /// @return the parameter R of scale \a k.
+    Scalar R( Index k ) const;
+    /// @return the parameter r in VCM(chi_r), i.e. an upper bound for
+    /// the diameter of the support of kernel functions.
+    Scalar r() const;
+
+    /**
+       Cleans intermediate data structure likes the characteristic set and the voronoi map.
+       @note Further calls to voronoiMap are no more valid, but
+       covariance matrices and \ref measure remain available.
+    */
+    void clean();
+
+    /**
+       Computes the Voronoi Covariance Measures for all the scales for
+       the set of points given by range [itb,ite)
+
+       @tparam PointInputIterator an input iterator on digital points.
+       @param itb the start of the range
+       @param ite the end of the range.
+       @pre \a itb != \a ite.
+       @pre [itb,ite) is a valid range (\a ite can be reached from \a itb).
+    */
+    template <typename PointInputIterator>
+    void init( PointInputIterator itb, PointInputIterator ite );
+
+    /// @return the domain of computation (the one of the biggest offset).
+    const Domain& domain() const;
+
+    /// @return the current Voronoi map
+    /// @pre init must have been called before and clean not called.
+    const Voronoi& voronoiMap() const;
+
+    /// @return the number of (distinct) points.
+    Size size() const;
+
+    /// @return the points, such that `points()[ i ]` is the point of index i.
+    const PointContainer& points() const;
+
+    /// @param p any point.
+    /// @return the index of point \a p if it belongs to the set, `size()` otherwise.
+    Index index( const Point& p ) const;
+
+    /// @param k any scale index in 0..nbScales()-1.
+    /// @param i any point index in 0..size()-1.
+    /// @return the Voronoi covariance matrix of the Voronoi cell of point \a i,
+    /// restricted to the R(k)-offset.
+    const MatrixNN& vcm( Index k, Index i ) const;
+
+    /**
+    Computes the Voronoi Covariance Measure of the function \a chi_r
+    at scale \a k.
+
+    @tparam Point2ScalarFunction the type of a functor
+    Point->Scalar. For instance functors::HatPointFunction and
+    functors::BallConstantPointFunction are models of this type.
+
+    @param k any scale index in 0..nbScales()-1.
+
+    @param chi_r the kernel function whose support is included in
+    the cube centered on the origin with edge size 2r.
+
+    @param p the point where the kernel function is moved. It must lie within domain.
+
+    @note This method is const and thread-safe, and may thus be
+    called concurrently.
+    */
+    template <typename Point2ScalarFunction>
+    MatrixNN measure( Index k, Point2ScalarFunction chi_r, Point p ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The parameters R in the VCM, i.e. the offset radii for the compact set K.
+    std::vector<Scalar> myBigRs;
+    /// For each scale k, its rank when scales are sorted by increasing R.
+    std::vector<Index> myRanks;
+    /// The parameter r in VCM(chi_r), i.e. an upper bound for the
+    /// diameter of the support of kernel functions.
+    Scalar mySmallR;
+    /// The metric chosen for the Voronoi map.
+    Metric myMetric;
+    /// Tells if it is verbose mode.
+    bool myVerbose;
+    /// The domain in which all computations are done.
+    Domain myDomain;
+    /// A binary image that defines the characteristic set of K.
+    CharacteristicSet* myCharSet;
+    /// Stores the voronoi map.
+    Voronoi* myVoronoi;
+    /// The structure used for proximity queries.
+    ProximityStructure* myProximityStructure;
+    /// The points of K.
+    PointContainer myPoints;
+    /// The map point -> index.
+    Point2Index myIndices;
+    /// The VCM of each point at each scale, stored by sorted scale
+    /// rank then point index.
+    std::vector<MatrixNN> myVCMs;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    MultiScaleVoronoiCovarianceMeasure();
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    MultiScaleVoronoiCovarianceMeasure ( const MultiScaleVoronoiCovarianceMeasure & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    MultiScaleVoronoiCovarianceMeasure & operator= ( const MultiScaleVoronoiCovarianceMeasure & other );
+
+  }; // end of class MultiScaleVoronoiCovarianceMeasure
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MultiScaleVoronoiCovarianceMeasure'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MultiScaleVoronoiCovarianceMeasure' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace, typename TSeparableMetric>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const MultiScaleVoronoiCovarianceMeasure<TSpace, TSeparableMetric> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/estimation/MultiScaleVoronoiCovarianceMeasure.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MultiScaleVoronoiCovarianceMeasure_h
+
+#undef MultiScaleVoronoiCovarianceMeasure_RECURSES
+#endif // else defined(MultiScaleVoronoiCovarianceMeasure_RECURSES)
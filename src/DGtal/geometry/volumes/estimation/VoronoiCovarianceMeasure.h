@@ -43,6 +43,7 @@
 #include <cmath>
 #include <iostream>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/Instrumentation.h"
 #include "DGtal/math/BasicMathFunctions.h"
 #include "DGtal/kernel/BasicPointPredicates.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
@@ -50,6 +50,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CountedPtr.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/ParallelDomainTraversal.h"
 #include "DGtal/kernel/RegularPointEmbedder.h"
 #include "DGtal/math/MPolynomial.h"
 #include "DGtal/math/Statistic.h"
@@ -601,10 +602,9 @@ namespace DGtal
         CountedPtr<BinaryImage> img ( new BinaryImage( shapeDomain ) );
         if ( noise <= 0.0 )
           {
-            std::transform( shapeDomain.begin(), shapeDomain.end(),
-                            img->begin(),
-                            [&shape_digitization]
-                            ( const Point& p ) { return (*shape_digitization)(p); } );
+            parallel::transform( shapeDomain, img->begin(),
+                                 [&shape_digitization]
+                                 ( const Point& p ) { return (*shape_digitization)(p); } );
           }
         else
           {
@@ -663,9 +663,8 @@ namespace DGtal
         typedef functors::IntervalForegroundPredicate<GrayScaleImage> ThresholdedImage;
         ThresholdedImage tImage( image, thresholdMin, thresholdMax );
         CountedPtr<BinaryImage> img ( new BinaryImage( domain ) );
-        std::transform( domain.begin(), domain.end(),
-                        img->begin(),
-                        [tImage] ( const Point& p ) { return tImage(p); } );
+        parallel::transform( domain, img->begin(),
+                             [&tImage] ( const Point& p ) { return tImage(p); } );
         return makeBinaryImage( img, params );
       }
 
@@ -691,9 +690,8 @@ namespace DGtal
         typedef functors::IntervalForegroundPredicate<GrayScaleImage> ThresholdedImage;
         ThresholdedImage tImage( *gray_scale_image, thresholdMin, thresholdMax );
         CountedPtr<BinaryImage> img ( new BinaryImage( domain ) );
-        std::transform( domain.begin(), domain.end(),
-                        img->begin(),
-                        [tImage] ( const Point& p ) { return tImage(p); } );
+        parallel::transform( domain, img->begin(),
+                             [&tImage] ( const Point& p ) { return tImage(p); } );
         return makeBinaryImage( img, params );
       }
 
@@ -811,12 +809,8 @@ namespace DGtal
           { return (unsigned char) std::min( 255.0f, std::max( 0.0f, qSlope * v + qShift ) ); };
         Domain domain = fimage->domain();
         auto   gimage = makeGrayScaleImage( domain );
-        auto       it = gimage->begin();
-        for ( auto p : domain )
-          {
-            float val = (*fimage)( p );
-            *it++      = f( val );
-          }
+        parallel::transform( domain, gimage->begin(),
+                             [&fimage,&f] ( const Point& p ) { return f( (*fimage)( p ) ); } );
         return gimage;
       }
 
@@ -843,12 +837,8 @@ namespace DGtal
           { return (unsigned char) std::min( 255.0, std::max( 0.0, qSlope * v + qShift ) ); };
         Domain domain = fimage->domain();
         auto   gimage = makeGrayScaleImage( domain );
-        auto       it = gimage->begin();
-        for ( auto p : domain )
-          {
-            double val = (*fimage)( p );
-            *it++      = f( val );
-          }
+        parallel::transform( domain, gimage->begin(),
+                             [&fimage,&f] ( const Point& p ) { return f( (*fimage)( p ) ); } );
         return gimage;
       }
 
@@ -909,12 +899,8 @@ namespace DGtal
         dshape->init( p1, p2, h );
         Domain domain = dshape->getDomain();
         auto   fimage = makeFloatImage( domain );
-        auto       it = fimage->begin();
-        for ( auto p : domain )
-          {
-            float val = (float) (*shape)( p );
-            *it++      = val;
-          }
+        parallel::transform( domain, fimage->begin(),
+                             [&shape] ( const Point& p ) { return (float) (*shape)( p ); } );
         return fimage;
       }
 
@@ -975,12 +961,8 @@ namespace DGtal
         dshape->init( p1, p2, h );
         Domain domain = dshape->getDomain();
         auto   fimage = makeDoubleImage( domain );
-        auto       it = fimage->begin();
-        for ( auto p : domain )
-          {
-            double val = (double) (*shape)( p );
-            *it++      = val;
-          }
+        parallel::transform( domain, fimage->begin(),
+                             [&shape] ( const Point& p ) { return (double) (*shape)( p ); } );
         return fimage;
       }
     
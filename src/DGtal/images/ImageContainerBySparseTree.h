@@ -0,0 +1,450 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerBySparseTree.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module ImageContainerBySparseTree.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerBySparseTree_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerBySparseTree.h
+#else // defined(ImageContainerBySparseTree_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerBySparseTree_RECURSES
+
+#if !defined ImageContainerBySparseTree_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerBySparseTree_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/Clone.h"
+#include "DGtal/base/CLabel.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/PointHashFunctions.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/SetValueIterator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContainerBySparseTree
+  /**
+     Description of template class 'ImageContainerBySparseTree' <p>
+     \brief Aim: A sparse image container, model of CImage, storing
+     values in a fixed-depth tree of dense bricks, like VDB grids.
+
+     The domain is partitioned into leaves, cubes of \f$ 2^{L} \f$
+     points per axis, grouped into nodes of \f$ 2^{N} \f$ leaves per
+     axis. Only the nodes containing at least one non-background
+     value are stored, in a hash map keyed by their position. Each
+     node stores, for each of its leaves, either a dense brick of
+     values or a single tile value for the whole leaf. Accessing a
+     value is thus one hash lookup followed by two array accesses,
+     and the ConstAccessor and Accessor classes skip the hash lookup
+     as long as consecutive points lie in the same leaf.
+
+     Writing a value creates its node and brick if needed, while
+     fill() writes tiles for the leaves fully covered by a box and
+     prune() turns uniform bricks back into tiles and removes the
+     nodes holding only background tiles.
+
+     Leaves may be processed in parallel (OpenMP) with forEachLeaf().
+     Other modifications are not thread-safe. Note also that
+     accessors and leaf pointers are invalidated when bricks are
+     created or removed by setValue(), fill() or prune() called on
+     the image.
+
+     @code
+     typedef ImageContainerBySparseTree< Z3i::Domain, float > Image;
+     Image image( domain, 3.0f ); // background is 3
+     for ( auto p : band ) image.setValue( p, distance( p ) );
+     image.prune();
+     Image::ConstAccessor acc( image );
+     for ( auto p : band ) sum += acc( p ); // cached leaf lookup
+     @endcode
+
+     @tparam TDomain a model of CDomain, for instance HyperRectDomain.
+     @tparam TValue a model of CLabel, the type of values.
+     @tparam LOG2_LEAF the log2 of the width of leaves (3 means 8^d bricks).
+     @tparam LOG2_NODE the log2 of the width of nodes, in leaves.
+   */
+  template < typename TDomain, typename TValue,
+             unsigned int LOG2_LEAF = 3, unsigned int LOG2_NODE = 4 >
+  class ImageContainerBySparseTree
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef ImageContainerBySparseTree<TDomain,TValue,LOG2_LEAF,LOG2_NODE> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT(( concepts::CDomain<TDomain> ));
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef Point Vertex;
+
+    /// domain dimension
+    static const typename Domain::Dimension dimension = Domain::dimension;
+
+    /// range of values
+    BOOST_CONCEPT_ASSERT(( concepts::CLabel<TValue> ));
+    typedef TValue Value;
+
+    /// range
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+
+    /// output iterator
+    typedef SetValueIterator<Self> OutputIterator;
+
+    /// The number of points per axis of a leaf.
+    static const Size leaf_width = Size( 1 ) << LOG2_LEAF;
+    /// The number of points of a leaf.
+    static const Size leaf_size  = Size( 1 ) << ( LOG2_LEAF * dimension );
+    /// The number of leaves per axis of a node.
+    static const Size node_width = Size( 1 ) << LOG2_NODE;
+    /// The number of leaves of a node.
+    static const Size node_size  = Size( 1 ) << ( LOG2_NODE * dimension );
+
+    /// A dense brick of values, indexed with the first axis varying fastest.
+    struct Leaf
+    {
+      Value values[ leaf_size ];
+    };
+
+    /// The leaves of a node, each one either a brick or a tile value.
+    struct Node
+    {
+      /// The bricks of the node, or null for tile leaves.
+      std::unique_ptr< std::unique_ptr< Leaf >[] > leaves;
+      /// The tile value of each leaf without brick.
+      std::unique_ptr< Value[] > tiles;
+    };
+
+    /// The nodes, keyed by the position of their first point relative
+    /// to the lower bound of the domain, divided by the width of a node.
+    typedef std::unordered_map< Point, std::unique_ptr< Node > > NodeMap;
+
+    // ----------------------- Accessors ------------------------------
+  public:
+
+    /**
+       A read-only accessor to an image, which caches the last leaf
+       accessed. It is invalidated when bricks are created or removed.
+    */
+    class ConstAccessor
+    {
+    public:
+      /// Constructor. @param image the accessed image (aliased).
+      ConstAccessor( const Self& image );
+      /// @param aPoint any point of the domain.
+      /// @return the value at \a aPoint.
+      Value operator()( const Point& aPoint );
+    protected:
+      /// The accessed image.
+      const Self* myImage;
+      /// The leaf index of the cached leaf.
+      Point myLeafIndex;
+      /// The cached brick values, or the cached tile value.
+      const Value* myValues;
+      /// True when myValues is a tile value.
+      bool myIsTile;
+      /// Caches the leaf of index \a l.
+      void cache( const Point& l );
+    };
+
+    /**
+       A read-write accessor to an image, which caches the last leaf
+       accessed. Writing through it does not invalidate it.
+    */
+    class Accessor : public ConstAccessor
+    {
+    public:
+      /// Constructor. @param image the accessed image (aliased).
+      Accessor( Self& image );
+      /// Sets a value.
+      /// @param aPoint any point of the domain.
+      /// @param aValue the value to write at \a aPoint.
+      void setValue( const Point& aPoint, const Value& aValue );
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor.
+       @param aDomain the image domain.
+       @param aBackground the value of the points not stored.
+    */
+    ImageContainerBySparseTree( Clone<const Domain> aDomain,
+                                const Value& aBackground = 0 );
+
+    /**
+       Copy constructor, copies all nodes and bricks.
+       @param other the object to clone.
+    */
+    ImageContainerBySparseTree( const Self& other );
+
+    /**
+       Assignment, copies all nodes and bricks.
+       @param other the object to copy.
+       @return a reference on 'this'.
+    */
+    Self& operator=( const Self& other );
+
+    /// Destructor.
+    ~ImageContainerBySparseTree() = default;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+       Get the value of an image at a given position.
+       @param aPoint position in the image.
+       @return the value at aPoint.
+    */
+    Value operator()( const Point& aPoint ) const;
+
+    /**
+       Set a value on an image at a given position.
+       @param aPoint position in the image.
+       @param aValue the value.
+    */
+    void setValue( const Point& aPoint, const Value& aValue );
+
+    /**
+       Sets \a aValue on all the points of the box [lower,upper], using
+       tiles for the leaves fully covered by the box.
+       @param lower the lower bound of the box.
+       @param upper the upper bound of the box.
+       @param aValue the value.
+    */
+    void fill( const Point& lower, const Point& upper, const Value& aValue );
+
+    /**
+       Replaces uniform bricks by tiles and removes nodes holding
+       only background tiles (bricks in parallel with OpenMP).
+    */
+    void prune();
+
+    /// Removes all values, which become the background.
+    void clear();
+
+    /// @return the image domain.
+    const Domain& domain() const;
+
+    /// @return the value of the points not stored.
+    const Value& background() const;
+
+    /// @return the constant range used to iterate over the values.
+    ConstRange constRange() const;
+
+    /// @return the range used to iterate over the values.
+    Range range();
+
+    /// @return an output iterator used to write values.
+    OutputIterator outputIterator();
+
+    /// @return the number of stored nodes.
+    Size nbNodes() const;
+
+    /// @return the number of dense bricks.
+    Size nbLeaves() const;
+
+    /// @return the number of tiles whose value is not the background.
+    Size nbTiles() const;
+
+    /// @return an estimate of the memory used by the image, in bytes.
+    Size memoryUsage() const;
+
+    // ----------------------- Leaf services ------------------------------
+  public:
+
+    /**
+       Calls f( origin, values ) for each dense brick, in parallel
+       with OpenMP, where origin is the first point of the leaf and
+       values its leaf_size values, the first axis varying fastest
+       (some points of the leaf may lie outside the domain).
+
+       @tparam LeafFunctor a functor ( const Point&, const Value* ) -> void,
+       which may be called concurrently on different leaves.
+    */
+    template < typename LeafFunctor >
+    void forEachLeaf( LeafFunctor f ) const;
+
+    /**
+       Calls f( origin, values ) for each dense brick, in parallel
+       with OpenMP, where values may be modified.
+
+       @tparam LeafFunctor a functor ( const Point&, Value* ) -> void,
+       which may be called concurrently on different leaves.
+    */
+    template < typename LeafFunctor >
+    void forEachLeaf( LeafFunctor f );
+
+    /**
+       Calls f( origin, value ) for each tile whose value is not the
+       background, where origin is the first point of its leaf.
+
+       @tparam TileFunctor a functor ( const Point&, const Value& ) -> void.
+    */
+    template < typename TileFunctor >
+    void forEachTile( TileFunctor f ) const;
+
+    /**
+       @param q a point relative to the lower bound of the domain.
+       @return the index in its leaf of the point \a q.
+    */
+    static Size leafOffset( const Point& q );
+
+    // ----------------------- Conversion services ------------------------------
+  public:
+
+    /**
+       Copies the values of the points of the domain of \a image
+       (which must lie within this domain), then prunes.
+       @tparam TImage a model of CConstImage, e.g. ImageContainerBySTLVector.
+       @param image the image to copy.
+    */
+    template < typename TImage >
+    void assign( const TImage& image );
+
+    /**
+       Writes the values of the points of the domain of \a image
+       (which must lie within this domain) in \a image.
+       @tparam TImage a model of CImage, e.g. ImageContainerBySTLVector.
+       @param[in,out] image the image to write.
+    */
+    template < typename TImage >
+    void exportTo( TImage& image ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the name of the class.
+     */
+    std::string className() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The image domain.
+    CowPtr<const Domain> myDomainPtr;
+    /// The value of the points not stored.
+    Value myBackground;
+    /// The stored nodes.
+    NodeMap myNodes;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @return the position of \a aPoint relative to the domain lower bound.
+    Point relative( const Point& aPoint ) const;
+
+    /// @return the index of the leaf containing the relative point \a q.
+    static Point leafIndex( const Point& q );
+
+    /// @return the index of the node containing the leaf of index \a l.
+    static Point nodeIndex( const Point& l );
+
+    /// @return the index in its node of the leaf of index \a l.
+    static Size childOffset( const Point& l );
+
+    /**
+       @param l a leaf index.
+       @param[out] isTile true if the returned pointer is a tile value.
+       @return the values of the brick of leaf \a l, or a pointer to
+       its tile value (possibly the background).
+    */
+    const Value* findLeaf( const Point& l, bool& isTile ) const;
+
+    /**
+       @param l a leaf index.
+       @return the values of the brick of leaf \a l, which is created
+       from its tile if needed.
+    */
+    Value* touchLeaf( const Point& l );
+
+    /// Moves \a p to the next point of the box [lo,hi], first axis first.
+    /// @return 'false' when \a p was the last point of the box.
+    static bool nextPoint( Point& p, const Point& lo, const Point& hi );
+
+    /// @return a new node with background tiles.
+    std::unique_ptr< Node > newNode() const;
+
+    /// Copies the nodes of \a other.
+    void copyNodes( const NodeMap& other );
+
+    /// Collects the bricks and their origins.
+    void collectLeaves( std::vector< Point >& origins,
+                        std::vector< Leaf* >& leaves ) const;
+
+  }; // end of class ImageContainerBySparseTree
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerBySparseTree'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerBySparseTree' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TDomain, typename TValue, unsigned int L, unsigned int N >
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ImageContainerBySparseTree<TDomain,TValue,L,N> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerBySparseTree.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerBySparseTree_h
+
+#undef ImageContainerBySparseTree_RECURSES
+#endif // else defined(ImageContainerBySparseTree_RECURSES)
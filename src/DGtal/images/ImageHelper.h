@@ -56,6 +56,8 @@
 #include "DGtal/images/CImage.h"
 #include "DGtal/base/CQuantity.h"
 #include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/kernel/domains/ParallelDomainTraversal.h"
 #include "DGtal/images/SetValueIterator.h"
 #include "DGtal/kernel/sets/DigitalSetFromMap.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
@@ -147,6 +149,44 @@ namespace DGtal
 		    const typename I::Value& low,
 		    const typename I::Value& up); 
 
+  /**
+   * Same as above for images stored in a vector: the thresholds are
+   * evaluated in parallel (OpenMP) over rows of the domain, the points
+   * are inserted sequentially, in the domain order.
+   *
+   * @param aImg any image
+   * @param ito set inserter
+   * @param aThreshold any value (default: 0)
+   *
+   * @tparam TSpace any model of CSpace
+   * @tparam V the type of values
+   * @tparam O any model of output iterator
+   */
+  template<typename TSpace, typename V, typename O>
+  void setFromImage(const ImageContainerBySTLVector<HyperRectDomain<TSpace>,V>& aImg, 
+		    const O& ito, 
+		    const typename ImageContainerBySTLVector<HyperRectDomain<TSpace>,V>::Value& aThreshold = 0); 
+
+  /**
+   * Same as above for images stored in a vector: the thresholds are
+   * evaluated in parallel (OpenMP) over rows of the domain, the points
+   * are inserted sequentially, in the domain order.
+   *
+   * @param aImg any image
+   * @param ito set inserter
+   * @param low lower value
+   * @param up upper value
+   *
+   * @tparam TSpace any model of CSpace
+   * @tparam V the type of values
+   * @tparam O any model of output iterator
+   */
+  template<typename TSpace, typename V, typename O>
+  void setFromImage(const ImageContainerBySTLVector<HyperRectDomain<TSpace>,V>& aImg, 
+		    const O& ito, 
+		    const typename ImageContainerBySTLVector<HyperRectDomain<TSpace>,V>::Value& low,
+		    const typename ImageContainerBySTLVector<HyperRectDomain<TSpace>,V>::Value& up); 
+
 
   /**
    * Set the values of @a aImg at @a aValue
@@ -192,6 +232,26 @@ namespace DGtal
   template<typename I, typename F>
   void imageFromFunctor(I& aImg, const F& aFun); 
 
+  namespace parallel
+  {
+    /**
+     * Same as DGtal::imageFromFunctor for images stored in a vector,
+     * but the values are computed in parallel (OpenMP) over rows of
+     * the domain, in no particular order. Each thread calls its own
+     * copy of @a aFun, and what @a aFun refers to must be thread-safe.
+     *
+     * @param aImg (returned) image
+     * @param aFun a unary functor
+     *
+     * @tparam TSpace any model of CSpace
+     * @tparam V the type of values
+     * @tparam F any model of CPointFunctor
+     */
+    template<typename TSpace, typename V, typename F>
+    void imageFromFunctor(ImageContainerBySTLVector<HyperRectDomain<TSpace>,V>& aImg, 
+			  const F& aFun); 
+  }
+
   /**
    * Copy the values of @a aImg2 into @a aImg1 .
    *
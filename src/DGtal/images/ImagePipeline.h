@@ -0,0 +1,327 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImagePipeline.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module ImagePipeline.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImagePipeline_RECURSES)
+#error Recursive header files inclusion detected in ImagePipeline.h
+#else // defined(ImagePipeline_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImagePipeline_RECURSES
+
+#if !defined ImagePipeline_h
+/** Prevents repeated inclusion of headers. */
+#define ImagePipeline_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <utility>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/ParallelDomainTraversal.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /**
+     Fused lazy image pipelines.
+
+     An image expression is a lazy point-wise computation over a
+     HyperRectDomain built from images (source), point-wise functors
+     (map, threshold, e.g. a colour map), point-wise operations
+     between two expressions (combine) and sub-sampling
+     (subsample). Contrary to chains of ConstImageAdapter, an
+     expression is not only evaluated point by point but also by
+     rows: evalRow computes consecutive values along the first axis
+     block by block (block_size values), each node reading the
+     values of its operands in small buffers and applying its
+     functor in a simple loop that the compiler may vectorize. Hence
+     no intermediate image is ever built and each image is read
+     contiguously.
+
+     materialise evaluates an expression into an
+     ImageContainerBySTLVector, possibly in parallel over rows
+     (OpenMP, see parallel::forEachSpan).
+
+     @code
+     typedef ImageContainerBySTLVector< Z3i::Domain, unsigned char > Image;
+     Image a( domain ), b( domain );
+     ...
+     auto diff   = pipeline::combine( pipeline::source( a ), pipeline::source( b ),
+                                      [] ( unsigned char x, unsigned char y ) { return int( x ) - int( y ); } );
+     auto binary = pipeline::threshold( pipeline::subsample( diff, Z3i::Point( 2, 2, 2 ) ), 10, 255 );
+     ImageContainerBySTLVector< Z3i::Domain, bool > result = pipeline::materialise( binary );
+     @endcode
+
+     Each expression type models the following concept: typedefs
+     Domain (a HyperRectDomain), Point, Size and Value, and methods
+     - const Domain& domain() const,
+     - Value operator()( const Point& p ) const,
+     - void evalRow( const Point& first, Size n, Value* out ) const,
+       which writes the values of the n points first, first + e_0,
+       ..., first + (n-1) e_0 of the domain in out.
+
+     Functors are copied in expressions and, since evaluations may
+     run concurrently, must be thread-safe. Images are aliased and
+     must outlive the expressions built on them.
+  */
+  namespace pipeline
+  {
+    /// The number of values computed at once by each node of an expression.
+    static const std::size_t block_size = 256;
+
+    /////////////////////////////////////////////////////////////////////////////
+    // template class ImageSource
+    /**
+       Description of template class 'ImageSource' <p> \brief Aim: The
+       leaf of an image expression, which reads the values of an image
+       (aliased). Rows of ImageContainerBySTLVector are copied.
+
+       @tparam TImage a model of CConstImage on a HyperRectDomain.
+    */
+    template < typename TImage >
+    class ImageSource
+    {
+    public:
+      typedef TImage                      Image;
+      typedef typename Image::Domain      Domain;
+      typedef typename Domain::Point      Point;
+      typedef typename Domain::Size       Size;
+      typedef typename Image::Value       Value;
+
+      /// Constructor. @param image the image (aliased).
+      ImageSource( const Image& image );
+      /// @return the domain of the image.
+      const Domain& domain() const;
+      /// @return the value at \a p.
+      Value operator()( const Point& p ) const;
+      /// Writes the values of the row of \a n points starting at \a first in \a out.
+      void evalRow( const Point& first, Size n, Value* out ) const;
+
+    private:
+      /// The image.
+      const Image* myImage;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////
+    // template class UnaryExpression
+    /**
+       Description of template class 'UnaryExpression' <p> \brief Aim:
+       An image expression applying a functor to the values of another one.
+
+       @tparam TExpression the type of the operand expression.
+       @tparam TFunctor a functor ( TExpression::Value ) -> Value.
+    */
+    template < typename TExpression, typename TFunctor >
+    class UnaryExpression
+    {
+    public:
+      typedef TExpression                    Expression;
+      typedef TFunctor                       Functor;
+      typedef typename Expression::Domain    Domain;
+      typedef typename Domain::Point         Point;
+      typedef typename Domain::Size          Size;
+      typedef typename Expression::Value     InputValue;
+      typedef typename std::decay<
+        decltype( std::declval<const Functor&>()( std::declval<InputValue>() ) ) >::type Value;
+
+      /// Constructor. @param e the operand. @param f the functor.
+      UnaryExpression( const Expression& e, const Functor& f );
+      /// @return the domain of the operand.
+      const Domain& domain() const;
+      /// @return the value at \a p.
+      Value operator()( const Point& p ) const;
+      /// Writes the values of the row of \a n points starting at \a first in \a out.
+      void evalRow( const Point& first, Size n, Value* out ) const;
+
+    private:
+      /// The operand.
+      Expression myExpression;
+      /// The functor.
+      Functor myFunctor;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////
+    // template class BinaryExpression
+    /**
+       Description of template class 'BinaryExpression' <p> \brief Aim:
+       An image expression combining the values of two others on the
+       same domain.
+
+       @tparam TExpression1 the type of the first operand expression.
+       @tparam TExpression2 the type of the second operand expression.
+       @tparam TFunctor a functor ( TExpression1::Value, TExpression2::Value ) -> Value.
+    */
+    template < typename TExpression1, typename TExpression2, typename TFunctor >
+    class BinaryExpression
+    {
+    public:
+      typedef TExpression1                   Expression1;
+      typedef TExpression2                   Expression2;
+      typedef TFunctor                       Functor;
+      typedef typename Expression1::Domain   Domain;
+      typedef typename Domain::Point         Point;
+      typedef typename Domain::Size          Size;
+      typedef typename Expression1::Value    InputValue1;
+      typedef typename Expression2::Value    InputValue2;
+      typedef typename std::decay<
+        decltype( std::declval<const Functor&>()( std::declval<InputValue1>(),
+                                                  std::declval<InputValue2>() ) ) >::type Value;
+
+      /// Constructor. @param e1 the first operand. @param e2 the
+      /// second operand, on the same domain. @param f the functor.
+      BinaryExpression( const Expression1& e1, const Expression2& e2, const Functor& f );
+      /// @return the domain of the operands.
+      const Domain& domain() const;
+      /// @return the value at \a p.
+      Value operator()( const Point& p ) const;
+      /// Writes the values of the row of \a n points starting at \a first in \a out.
+      void evalRow( const Point& first, Size n, Value* out ) const;
+
+    private:
+      /// The first operand.
+      Expression1 myExpression1;
+      /// The second operand.
+      Expression2 myExpression2;
+      /// The functor.
+      Functor myFunctor;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////
+    // template class SubsampledExpression
+    /**
+       Description of template class 'SubsampledExpression' <p>
+       \brief Aim: An image expression sub-sampling another one: the
+       value at point p is the value of the operand at point
+       lower + ( p - lower ) * steps (component-wise), where lower is
+       the lower bound of both domains.
+
+       @tparam TExpression the type of the operand expression.
+    */
+    template < typename TExpression >
+    class SubsampledExpression
+    {
+    public:
+      typedef TExpression                    Expression;
+      typedef typename Expression::Domain    Domain;
+      typedef typename Domain::Point         Point;
+      typedef typename Domain::Size          Size;
+      typedef typename Expression::Value     Value;
+
+      /// Constructor. @param e the operand. @param steps the
+      /// positive sub-sampling step along each axis.
+      SubsampledExpression( const Expression& e, const Point& steps );
+      /// @return the sub-sampled domain.
+      const Domain& domain() const;
+      /// @return the value at \a p.
+      Value operator()( const Point& p ) const;
+      /// Writes the values of the row of \a n points starting at \a first in \a out.
+      void evalRow( const Point& first, Size n, Value* out ) const;
+
+    private:
+      /// The operand.
+      Expression myExpression;
+      /// The sub-sampling steps.
+      Point mySteps;
+      /// The sub-sampled domain.
+      Domain myDomain;
+
+      /// @return the point of the operand domain corresponding to \a p.
+      Point sourcePoint( const Point& p ) const;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////
+    /// Functor returning true for values in ]low,up], as IntervalForegroundPredicate.
+    template < typename TValue >
+    struct IntervalThreshold
+    {
+      /// The excluded lower bound and the included upper bound.
+      TValue low, up;
+      /// @return 'true' iff low < v <= up.
+      bool operator()( const TValue& v ) const { return ( low < v ) && ( v <= up ); }
+    };
+
+    // ----------------------- Builders ------------------------------
+
+    /// @return the expression reading \a image (aliased).
+    template < typename TImage >
+    ImageSource< TImage > source( const TImage& image );
+
+    /// @return the expression applying \a f to the values of \a e
+    /// (e.g. a GradientColorMap).
+    template < typename TExpression, typename TFunctor >
+    UnaryExpression< TExpression, TFunctor >
+    map( const TExpression& e, const TFunctor& f );
+
+    /// @return the binary expression whose values are 'true' where
+    /// the values v of \a e satisfy low < v <= up.
+    template < typename TExpression >
+    UnaryExpression< TExpression, IntervalThreshold< typename TExpression::Value > >
+    threshold( const TExpression& e, const typename TExpression::Value& low,
+               const typename TExpression::Value& up );
+
+    /// @return the expression whose values are f( v1, v2 ) for values
+    /// v1 of \a e1 and v2 of \a e2 (e.g. std::plus), on the same domain.
+    template < typename TExpression1, typename TExpression2, typename TFunctor >
+    BinaryExpression< TExpression1, TExpression2, TFunctor >
+    combine( const TExpression1& e1, const TExpression2& e2, const TFunctor& f );
+
+    /// @return the expression sub-sampling \a e with the given steps.
+    template < typename TExpression >
+    SubsampledExpression< TExpression >
+    subsample( const TExpression& e, const typename TExpression::Point& steps );
+
+    // ----------------------- Evaluation ------------------------------
+
+    /**
+       Evaluates an expression row by row into an image.
+
+       @param e any image expression.
+       @param inParallel when 'true', rows are evaluated in parallel (OpenMP).
+       @return the image of the values of \a e on its domain.
+    */
+    template < typename TExpression >
+    ImageContainerBySTLVector< typename TExpression::Domain, typename TExpression::Value >
+    materialise( const TExpression& e, bool inParallel = true );
+
+  } // namespace pipeline
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImagePipeline.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImagePipeline_h
+
+#undef ImagePipeline_RECURSES
+#endif // else defined(ImagePipeline_RECURSES)
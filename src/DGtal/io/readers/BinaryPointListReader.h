@@ -0,0 +1,215 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BinaryPointListReader.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module BinaryPointListReader.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BinaryPointListReader_RECURSES)
+#error Recursive header files inclusion detected in BinaryPointListReader.h
+#else // defined(BinaryPointListReader_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BinaryPointListReader_RECURSES
+
+#if !defined BinaryPointListReader_h
+/** Prevents repeated inclusion of headers. */
+#define BinaryPointListReader_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BinaryPointListReader
+  /**
+   * Description of template struct 'BinaryPointListReader' <p>
+   * \brief Aim: Imports a list of points, with optional per-point
+   * attributes, stored in the binary point list format written by
+   * BinaryPointListWriter.
+   *
+   * The file is made of a header followed by blocks of points. Within
+   * a block, the coordinates are packed by axis and followed by the
+   * attributes (double), packed by attribute (see
+   * BinaryPointListWriter for the details). Coordinates are converted
+   * to the component type of \a TPoint whatever their type in the
+   * file, and data written on a machine of the other endianness are
+   * swapped.
+   *
+   * Points are read by blocks, so that big point clouds can be
+   * processed without loading all of them:
+   * @code
+   * std::size_t nb = BinaryPointListReader<Z3i::RealPoint>::processPointsFromFile
+   *   ( "cloud.dpl", [&] ( const std::vector<Z3i::RealPoint>& points,
+   *                        const std::vector<double>& attributes ) { ... } );
+   * @endcode
+   *
+   * A DGtal::IOException is thrown in case of io problems or invalid
+   * file. In particular, the number of points of a block is checked
+   * against the remaining size of the stream before any allocation
+   * (when the stream cannot seek, only against the maximal memory size).
+   *
+   * @tparam TPoint the type of point, whose components are of arithmetic type.
+   *
+   * @see BinaryPointListWriter, PointListReader, testBinaryPointListReader.cpp
+   */
+  template <typename TPoint>
+  struct BinaryPointListReader
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TPoint Point;
+    typedef typename TPoint::Component Component;
+
+    /// The description of a binary point list given by its header.
+    struct Header
+    {
+      /// The dimension of the points.
+      unsigned int dimension;
+      /// The kind of coordinates: 0 for signed integers, 1 for
+      /// unsigned integers and 2 for floating-point numbers.
+      unsigned int componentKind;
+      /// The size in bytes of a coordinate.
+      unsigned int componentSize;
+      /// The number of attributes of each point.
+      unsigned int nbAttributes;
+      /// 'true' if the file has been written with the other endianness.
+      bool swapped;
+    };
+
+    /**
+     * Imports all the points of a binary point list file.
+     *
+     * @param filename the input filename.
+     * @param[out] attributes when not null, the attributes of the
+     * points, point after point.
+     * @return a vector containing the set of points.
+     */
+    static std::vector<TPoint>
+    getPointsFromFile( const std::string & filename,
+                       std::vector<double>* attributes = 0 );
+
+    /**
+     * Imports all the points of a binary point list stream.
+     *
+     * @param in the input stream (opened in binary mode).
+     * @param[out] attributes when not null, the attributes of the
+     * points, point after point.
+     * @return a vector containing the set of points.
+     */
+    static std::vector<TPoint>
+    getPointsFromInputStream( std::istream & in,
+                              std::vector<double>* attributes = 0 );
+
+    /**
+     * Reads the points of a binary point list file block after block.
+     *
+     * @tparam TBatchFunctor the type of a functor called as
+     * 'batchFunctor( const std::vector<TPoint>& points, const std::vector<double>& attributes )'.
+     *
+     * @param filename the input filename.
+     * @param batchFunctor the functor called with the points of each
+     * block and their attributes, point after point.
+     * @return the number of points read.
+     */
+    template <typename TBatchFunctor>
+    static std::size_t
+    processPointsFromFile( const std::string & filename, TBatchFunctor batchFunctor );
+
+    /**
+     * Reads the points of a binary point list stream block after block.
+     *
+     * @tparam TBatchFunctor the type of a functor called as
+     * 'batchFunctor( const std::vector<TPoint>& points, const std::vector<double>& attributes )'.
+     *
+     * @param in the input stream (opened in binary mode).
+     * @param batchFunctor the functor called with the points of each
+     * block and their attributes, point after point.
+     * @return the number of points read.
+     */
+    template <typename TBatchFunctor>
+    static std::size_t
+    processPointsFromInputStream( std::istream & in, TBatchFunctor batchFunctor );
+
+    /**
+     * Reads the header of a binary point list stream.
+     *
+     * @param in the input stream (opened in binary mode).
+     * @return the header.
+     */
+    static Header readHeader( std::istream & in );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Reads n values of the type given by the header and converts them.
+     *
+     * @tparam TValue the type of the converted values.
+     * @param in the input stream.
+     * @param header the header of the stream.
+     * @param kind the kind of the stored values (see Header::componentKind).
+     * @param size the size in bytes of the stored values.
+     * @param n the number of values.
+     * @param[out] output the first converted value, followed by the
+     * others every \a stride values.
+     * @param stride the distance between two converted values.
+     * @param buffer a buffer for the bytes read.
+     */
+    template <typename TValue>
+    static void readValues( std::istream & in, const Header & header,
+                            unsigned int kind, unsigned int size, std::size_t n,
+                            TValue* output, std::size_t stride,
+                            std::vector<char> & buffer );
+
+    /**
+     * @param in the input stream.
+     * @return the number of bytes between the current position and
+     * the end of the stream, or the maximal value of std::size_t
+     * when the stream cannot seek.
+     */
+    static std::size_t remainingSize( std::istream & in );
+
+  }; // end of class BinaryPointListReader
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/BinaryPointListReader.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BinaryPointListReader_h
+
+#undef BinaryPointListReader_RECURSES
+#endif // else defined(BinaryPointListReader_RECURSES)
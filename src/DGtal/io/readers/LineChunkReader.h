@@ -0,0 +1,177 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file LineChunkReader.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module LineChunkReader.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(LineChunkReader_RECURSES)
+#error Recursive header files inclusion detected in LineChunkReader.h
+#else // defined(LineChunkReader_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define LineChunkReader_RECURSES
+
+#if !defined LineChunkReader_h
+/** Prevents repeated inclusion of headers. */
+#define LineChunkReader_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class LineChunkReader
+  /**
+   * Description of class 'LineChunkReader' <p>
+   * \brief Aim: Reads a text input stream by big chunks of complete
+   * lines, so that text files made of millions of lines (point
+   * clouds, tables) can be parsed by batches, and the lines of a
+   * batch in parallel.
+   *
+   * The stream is read by blocks of raw characters, which avoids the
+   * cost of \c std::getline and of a \c std::istringstream per line.
+   * As in PointListReader and TableReader, empty lines and lines
+   * beginning with "#" are skipped. Tokens are separated by space or
+   * tab characters (any character for which \c isspace is true), and
+   * are converted with \c strtol / \c strtod like functions for
+   * arithmetic types, or with \c operator>> otherwise. Floating-point
+   * values are always read in the "C" locale (with \c strtod_l), so
+   * that a global locale set with \c setlocale (e.g. with a decimal
+   * comma) does not change them. Like \c operator>>, the conversion
+   * of floating-point values rejects infinite values ("inf" or
+   * overflows) and "nan", and reads hexadecimal numbers as their
+   * prefix "0".
+   *
+   * Unlike a loop on \c std::getline checking \c good(), the last
+   * line of the stream is returned even if it does not end with an
+   * end of line character.
+   *
+   * @code
+   * LineChunkReader reader( in );
+   * std::vector< LineChunkReader::Line > lines;
+   * while ( reader.nextLines( lines ) )
+   *   for ( auto line : lines )
+   *     {
+   *       LineChunkReader::Line token;
+   *       const char* it = line.first;
+   *       while ( LineChunkReader::nextToken( it, line.second, token ) )
+   *         ...
+   *     }
+   * @endcode
+   *
+   * @see PointListReader, TableReader
+   */
+  class LineChunkReader
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    /// A line or a token, as a range [first,second) of characters.
+    typedef std::pair< const char*, const char* > Line;
+
+    /**
+     * Constructor.
+     *
+     * @param in the input stream, which must outlive this object.
+     * @param chunkSize the number of characters read at once (the
+     * chunk grows if a line is longer). Larger chunks may help on
+     * huge files.
+     */
+    LineChunkReader( std::istream & in, std::size_t chunkSize = 1 << 16 );
+
+    /**
+     * Reads the next chunk of complete lines.
+     *
+     * @param[out] lines the non empty, non comment lines of the
+     * chunk, without their end of line character. They are valid
+     * until the next call.
+     *
+     * @return 'false' when the end of the stream has been reached
+     * and no more line is available.
+     */
+    bool nextLines( std::vector< Line > & lines );
+
+    /**
+     * Extracts the next token of a line.
+     *
+     * @param[in,out] it the current position in the line, moved past the token.
+     * @param itE the end of the line.
+     * @param[out] token the token when found.
+     * @return 'true' if a token was found.
+     */
+    static bool nextToken( const char* & it, const char* itE, Line & token );
+
+    /**
+     * Converts a token to a value. Like \c operator>>, the
+     * conversion succeeds when a prefix of the token represents a
+     * value of type T (e.g. "2.0" gives the integer 2).
+     *
+     * @tparam T the type of the value.
+     * @param token a token of the current chunk.
+     * @param[out] value the converted value.
+     * @return 'true' if the conversion succeeded.
+     */
+    template <typename T>
+    static bool parse( const Line & token, T & value );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The input stream.
+    std::istream & myIn;
+    /// The number of characters read at once.
+    std::size_t myChunkSize;
+    /// The characters read and not yet returned, followed by a 0.
+    std::vector< char > myBuffer;
+    /// The number of characters read and not yet returned.
+    std::size_t mySize;
+    /// The position of the first character not yet returned.
+    std::size_t myStart;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+    LineChunkReader( const LineChunkReader & other );
+    LineChunkReader & operator=( const LineChunkReader & other );
+
+  }; // end of class LineChunkReader
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/LineChunkReader.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined LineChunkReader_h
+
+#undef LineChunkReader_RECURSES
+#endif // else defined(LineChunkReader_RECURSES)
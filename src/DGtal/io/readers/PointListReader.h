@@ -44,6 +44,7 @@
 #include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/geometry/curves/FreemanChain.h" 
+#include "DGtal/io/readers/LineChunkReader.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -76,6 +77,20 @@ namespace DGtal
    vIndice.push_back(2); // select for Y coordinate the third position number of the line.
    vector<Z2i::Point> vectPoints = PointListReader<Z2i::Point>::getPointsFromFile(filename,vectPos);
    *  @endcode
+   *
+   * Big files may be processed by batches of points, without
+   * loading all of them:
+   *  @code
+   std::size_t nb = PointListReader<Z3i::Point>::processPointsFromFile
+     ( filename, [&] ( const std::vector<Z3i::Point>& batch ) { ... }, 100000 );
+   *  @endcode
+   *
+   * The file is read by big chunks of lines (see LineChunkReader)
+   * whose lines are parsed in parallel when OpenMP is available.
+   * The last line is read even if it does not end with an end of line
+   * character (it was ignored before), and floating-point coordinates
+   * "inf" or "nan" are rejected like with operator>>.
+   * For faster imports, see the binary format of BinaryPointListReader.
    *   
    * @see testPointListReader.cpp
    **/
@@ -115,6 +130,50 @@ namespace DGtal
     static std::vector< TPoint>  
     getPointsFromFile (const std::string &filename, 
            std::vector<unsigned int>  aVectPosition=std::vector<unsigned int>());
+
+    /**
+     * Reads the points defined in an input stream, where each line
+     * defines a point, by batches of points. Blank line or line
+     * beginning with "#" are skipped.
+     *
+     * @tparam TBatchFunctor the type of a functor called as
+     * 'batchFunctor( const std::vector<TPoint>& batch )'.
+     *
+     * @param in the input stream.
+     * @param batchFunctor the functor called with each batch of points,
+     * in the order of the stream.
+     * @param batchSize the number of points of each batch (except the last one).
+     * @param aVectPosition used to specify the position of indices of
+     * value points  (default set to 0,..,dimension).
+     * @return the number of points read.
+     **/
+    template <typename TBatchFunctor>
+    static std::size_t
+    processPointsFromInputStream (std::istream &in, TBatchFunctor batchFunctor,
+                                  std::size_t batchSize = 65536,
+                                  std::vector<unsigned int> aVectPosition=std::vector<unsigned int>());
+
+    /**
+     * Reads the points defined in a file, where each line defines a
+     * point, by batches of points. Blank line or line beginning with
+     * "#" are skipped.
+     *
+     * @tparam TBatchFunctor the type of a functor called as
+     * 'batchFunctor( const std::vector<TPoint>& batch )'.
+     *
+     * @param filename a filename
+     * @param batchFunctor the functor called with each batch of points,
+     * in the order of the file.
+     * @param batchSize the number of points of each batch (except the last one).
+     * @param aVectPosition used to specify the position of indices of
+     * value points  (default set to 0,..,dimension).
+     * @return the number of points read.
+     **/
+    template <typename TBatchFunctor>
+    static std::size_t
+    processPointsFromFile (const std::string &filename, TBatchFunctor batchFunctor,
+                           std::size_t batchSize = 65536,
+                           std::vector<unsigned int> aVectPosition=std::vector<unsigned int>());
   
 
 
@@ -158,6 +217,21 @@ namespace DGtal
     template < typename TInteger > 
     static std::vector< FreemanChain< TInteger > > 
     getFreemanChainsFromFile (const std::string &filename);
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Extracts a point from a line.
+     *
+     * @param line a line of the current chunk.
+     * @param aVectPosition the position of indices of value points.
+     * @param[out] p the point when found.
+     * @return 'true' if all the coordinates of the point were found.
+     **/
+    static bool
+    parsePoint (const LineChunkReader::Line &line,
+                const std::vector<unsigned int> &aVectPosition, TPoint &p);
   
   
   
@@ -44,6 +44,7 @@
 #include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/io/readers/LineChunkReader.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -78,6 +79,12 @@ namespace DGtal
    *int>::getColumnElementsFromFile(filename, 2);
    *  @endcode
    *
+   * Big files may be processed by batches of lines (see
+   * processLinesElementsFromFile), whose elements are parsed in
+   * parallel when OpenMP is available (see LineChunkReader). The
+   * last line is read even if it does not end with an end of line
+   * character (it was ignored before).
+   *
    * @see testTableReader.cpp
    * @tparam TQuantity the type fo the integer to be read.
    **/
@@ -143,6 +150,46 @@ namespace DGtal
   static std::vector<std::vector<TQuantity>>
   getLinesElementsFromInputStream( std::istream & in );
 
+  /**
+   * Method to read the line elements of a given input stream by
+   * batches of lines, without loading all of them.  Each elements
+   * are identified between space or tab characters. Blank line or
+   * line beginning with "#" are skipped.
+   *
+   * @tparam TBatchFunctor the type of a functor called as
+   * 'batchFunctor( const std::vector<std::vector<TQuantity>>& batch )'.
+   *
+   * @param in the input stream.
+   * @param batchFunctor the functor called with each batch of lines,
+   * in the order of the stream.
+   * @param batchSize the number of lines of each batch (except the last one).
+   * @return the number of lines read.
+   **/
+  template <typename TBatchFunctor>
+  static std::size_t
+  processLinesElementsFromInputStream( std::istream & in, TBatchFunctor batchFunctor,
+                                       std::size_t batchSize = 65536 );
+
+  /**
+   * Method to read the line elements of a given file by batches of
+   * lines, without loading all of them.  Each elements are
+   * identified between space or tab characters. Blank line or line
+   * beginning with "#" are skipped.
+   *
+   * @tparam TBatchFunctor the type of a functor called as
+   * 'batchFunctor( const std::vector<std::vector<TQuantity>>& batch )'.
+   *
+   * @param aFilename the input file.
+   * @param batchFunctor the functor called with each batch of lines,
+   * in the order of the file.
+   * @param batchSize the number of lines of each batch (except the last one).
+   * @return the number of lines read.
+   **/
+  template <typename TBatchFunctor>
+  static std::size_t
+  processLinesElementsFromFile( const std::string & aFilename, TBatchFunctor batchFunctor,
+                                std::size_t batchSize = 65536 );
+
   }; // end of class TableReader
 
 
@@ -0,0 +1,192 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BinaryPointListWriter.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module BinaryPointListWriter.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BinaryPointListWriter_RECURSES)
+#error Recursive header files inclusion detected in BinaryPointListWriter.h
+#else // defined(BinaryPointListWriter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BinaryPointListWriter_RECURSES
+
+#if !defined BinaryPointListWriter_h
+/** Prevents repeated inclusion of headers. */
+#define BinaryPointListWriter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BinaryPointListWriter
+  /**
+   * Description of template class 'BinaryPointListWriter' <p>
+   * \brief Aim: Exports a list of points, with optional per-point
+   * attributes, in a simple binary format that is much faster to
+   * read than text (see BinaryPointListReader).
+   *
+   * The format is made of a header of 32 bytes followed by blocks of
+   * points:
+   * - header: the 8 characters "DGtalPL1", then six 32-bit unsigned
+   *   integers: the byte order mark 0x01020304, the dimension, the
+   *   kind of coordinates (0: signed integer, 1: unsigned integer,
+   *   2: floating-point number), the size in bytes of a coordinate,
+   *   the number of attributes per point and 0 (reserved).
+   * - block: the number n of points of the block as a 64-bit unsigned
+   *   integer, then for each axis the n coordinates of the points
+   *   along this axis, then for each attribute the n values (double)
+   *   of this attribute.
+   * - the last block is empty (n = 0).
+   *
+   * All values are written with the byte order of the writing
+   * machine, which the reader detects with the byte order mark.
+   * Points may be written by several calls to \ref write, so that big
+   * point clouds never have to be in memory at once:
+   * @code
+   * std::ofstream out( "cloud.dpl", std::ios::out | std::ios::binary );
+   * BinaryPointListWriter<Z3i::RealPoint> writer( out, 1 ); // one attribute per point
+   * writer.write( points, attributes );
+   * ...
+   * writer.close();
+   * @endcode
+   *
+   * A DGtal::IOException is thrown in case of io problems.
+   *
+   * @tparam TPoint the type of point, whose components are of arithmetic type.
+   *
+   * @see BinaryPointListReader, testBinaryPointListReader.cpp
+   */
+  template <typename TPoint>
+  class BinaryPointListWriter
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TPoint Point;
+    typedef typename TPoint::Component Component;
+    BOOST_STATIC_ASSERT(( std::is_arithmetic<Component>::value ));
+
+    /**
+     * Constructor. Writes the header.
+     *
+     * @param out the output stream (opened in binary mode), which
+     * must outlive this object.
+     * @param nbAttributes the number of attributes of each point.
+     * @param blockSize the maximal number of points of a block.
+     */
+    BinaryPointListWriter( std::ostream & out, unsigned int nbAttributes = 0,
+                           std::size_t blockSize = 1 << 20 );
+
+    /**
+     * Destructor. Closes the point list if needed.
+     */
+    ~BinaryPointListWriter();
+
+    /**
+     * Appends points to the point list.
+     *
+     * @param points the points to write.
+     * @param attributes the attributes of the points, point after
+     * point (its size must be the number of points times the number of
+     * attributes).
+     */
+    void write( const std::vector<TPoint> & points,
+                const std::vector<double> & attributes = std::vector<double>() );
+
+    /**
+     * Ends the point list. Nothing can be written afterwards.
+     */
+    void close();
+
+    /**
+     * @return the number of points written so far.
+     */
+    std::size_t size() const;
+
+    /**
+     * Exports a vector of points in a binary point list file.
+     *
+     * @param filename the output filename.
+     * @param points the points to write.
+     * @param nbAttributes the number of attributes of each point.
+     * @param attributes the attributes of the points, point after point.
+     * @return true if no errors occur.
+     */
+    static bool exportFile( const std::string & filename,
+                            const std::vector<TPoint> & points,
+                            unsigned int nbAttributes = 0,
+                            const std::vector<double> & attributes = std::vector<double>() );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The output stream.
+    std::ostream & myOut;
+    /// The number of attributes of each point.
+    unsigned int myNbAttributes;
+    /// The maximal number of points of a block.
+    std::size_t myBlockSize;
+    /// The number of points written so far.
+    std::size_t mySize;
+    /// 'true' when the point list has been ended.
+    bool myIsClosed;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+    BinaryPointListWriter( const BinaryPointListWriter & other );
+    BinaryPointListWriter & operator=( const BinaryPointListWriter & other );
+
+    /**
+     * Writes the values of an array and checks the stream.
+     *
+     * @param values the first value.
+     * @param n the number of values.
+     */
+    template <typename TValue>
+    void writeValues( const TValue* values, std::size_t n );
+
+  }; // end of class BinaryPointListWriter
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/writers/BinaryPointListWriter.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BinaryPointListWriter_h
+
+#undef BinaryPointListWriter_RECURSES
+#endif // else defined(BinaryPointListWriter_RECURSES)
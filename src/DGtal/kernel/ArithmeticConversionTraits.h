@@ -124,6 +124,29 @@ namespace DGtal
     using type = typename std::common_type<T, U>::type; //! Arithmetic operation result type.
   };
 
+#ifdef WITH_INT128
+  /** @brief Specialization for 128-bit integers (see WITH_INT128)
+   * operated with themselves or with arithmetic types, when the
+   * standard type traits do not consider them as arithmetic types
+   * (i.e. with -std=c++NN instead of -std=gnu++NN).
+   *
+   * Resulting type is deduced from usual arithmetic conversion.
+   *
+   * @see ArithmeticConversionTraits
+   */
+  template <typename T, typename U>
+  struct ArithmeticConversionTraits< T, U,
+      typename std::enable_if<
+           ( std::is_same<T, DGtal::int128_t>::value || std::is_same<T, DGtal::uint128_t>::value
+             || std::is_same<U, DGtal::int128_t>::value || std::is_same<U, DGtal::uint128_t>::value )
+        && ( std::is_arithmetic<T>::value || std::is_same<T, DGtal::int128_t>::value || std::is_same<T, DGtal::uint128_t>::value )
+        && ( std::is_arithmetic<U>::value || std::is_same<U, DGtal::int128_t>::value || std::is_same<U, DGtal::uint128_t>::value )
+        && ! ( std::is_arithmetic<T>::value && std::is_arithmetic<U>::value ) >::type >
+  {
+    using type = decltype( std::declval<T>() + std::declval<U>() ); //! Arithmetic operation result type.
+  };
+#endif
+
   /** @brief Result type of arithmetic binary operators between two given types.
    *
    * @tparam T      First operand type.
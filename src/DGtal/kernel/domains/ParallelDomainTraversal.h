@@ -0,0 +1,265 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ParallelDomainTraversal.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module ParallelDomainTraversal.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ParallelDomainTraversal_RECURSES)
+#error Recursive header files inclusion detected in ParallelDomainTraversal.h
+#else // defined(ParallelDomainTraversal_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ParallelDomainTraversal_RECURSES
+
+#if !defined ParallelDomainTraversal_h
+/** Prevents repeated inclusion of headers. */
+#define ParallelDomainTraversal_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /**
+     Parallel (OpenMP) traversals of HyperRectDomain.
+
+     The points of a box of a domain are split into chunks made of
+     whole rows (lines along the first axis). Each chunk is handed
+     to a worker as spans of consecutive points, given by a range of
+     linear indices in the domain (the first axis varying fastest, as
+     in ImageContainerBySTLVector) and by its first point, so that
+     workers only increment points along rows instead of going
+     through HyperRectDomain iterators.
+
+     Functors are called concurrently on distinct points, in no
+     particular order. Each thread calls its own copy of the functor,
+     so that functors with a state do not share it, but what they
+     reference (e.g. captured by reference) must be thread-safe.
+     Without OpenMP, traversals are sequential and visit points in
+     the domain order.
+
+     @code
+     Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 1023, 1023, 1023 ) );
+     ImageContainerBySTLVector< Z3i::Domain, float > image( domain );
+     parallel::transform( domain, image.begin(),
+                          [] ( const Z3i::Point& p ) { return float( p.norm() ); } );
+     double sum = parallel::reduce( domain, 0.0,
+                                    [&] ( const Z3i::Point& p ) { return image( p ); },
+                                    std::plus< double >() );
+     @endcode
+  */
+  namespace parallel
+  {
+    /**
+       Calls f( begin, end, first ) for spans of consecutive points
+       covering the domain, in parallel: [begin,end) is the range of
+       linear indices of the span and first its first point. The
+       boundaries of spans are row-aligned and multiples of
+       granularity.
+
+       @param domain any domain.
+       @param f a functor ( Size, Size, const Point& ) -> void.
+       @param granularity when non zero, a number of points which
+       divides the linear index of the first point of each span (e.g.
+       to write packed values such as std::vector<bool>).
+    */
+    template < typename TSpace, typename SpanFunctor >
+    void forEachSpan( const HyperRectDomain< TSpace >& domain, SpanFunctor f,
+                      typename HyperRectDomain< TSpace >::Size granularity = 0 );
+
+    /**
+       Calls f( begin, end, first ) for each row of the box
+       [lower,upper] of the domain, in parallel: [begin,end) is the
+       range of linear indices of the row in the domain and first its
+       first point.
+
+       @param domain any domain.
+       @param lower the lower bound of a box included in the domain.
+       @param upper the upper bound of a box included in the domain.
+       @param f a functor ( Size, Size, const Point& ) -> void.
+    */
+    template < typename TSpace, typename SpanFunctor >
+    void forEachSpan( const HyperRectDomain< TSpace >& domain,
+                      const typename TSpace::Point& lower,
+                      const typename TSpace::Point& upper, SpanFunctor f );
+
+    /**
+       Calls f( index, p ) for each point p of the domain, in parallel,
+       where index is the linear index of p in the domain.
+
+       @param domain any domain.
+       @param f a functor ( Size, const Point& ) -> void.
+    */
+    template < typename TSpace, typename Functor >
+    void forEach( const HyperRectDomain< TSpace >& domain, Functor f );
+
+    /**
+       Calls f( index, p ) for each point p of the box [lower,upper]
+       of the domain, in parallel, where index is the linear index of
+       p in the domain.
+
+       @param domain any domain.
+       @param lower the lower bound of a box included in the domain.
+       @param upper the upper bound of a box included in the domain.
+       @param f a functor ( Size, const Point& ) -> void.
+    */
+    template < typename TSpace, typename Functor >
+    void forEach( const HyperRectDomain< TSpace >& domain,
+                  const typename TSpace::Point& lower,
+                  const typename TSpace::Point& upper, Functor f );
+
+    /**
+       Writes f( p ) at position out + index for each point p of the
+       domain of linear index index, in parallel. Equivalent to
+       std::transform( domain.begin(), domain.end(), out, f ).
+
+       @param domain any domain.
+       @param out a random access output iterator (including those of
+       std::vector<bool>) on at least domain.size() values.
+       @param f a functor ( const Point& ) -> value.
+    */
+    template < typename TSpace, typename RandomAccessIterator, typename Functor >
+    void transform( const HyperRectDomain< TSpace >& domain,
+                    RandomAccessIterator out, Functor f );
+
+    /**
+       @param domain any domain.
+       @param init the neutral element of op.
+       @param f a functor ( const Point& ) -> T.
+       @param op an associative functor ( T, T ) -> T.
+       @return the reduction with op of init and of the values f( p )
+       for all the points p of the domain, partial results being
+       combined in the domain order.
+    */
+    template < typename TSpace, typename T, typename Functor, typename BinaryOperation >
+    T reduce( const HyperRectDomain< TSpace >& domain, T init,
+              Functor f, BinaryOperation op );
+
+    /**
+       @param domain any domain.
+       @param lower the lower bound of a box included in the domain.
+       @param upper the upper bound of a box included in the domain.
+       @param init the neutral element of op.
+       @param f a functor ( const Point& ) -> T.
+       @param op an associative functor ( T, T ) -> T.
+       @return the reduction with op of init and of the values f( p )
+       for all the points p of the box [lower,upper].
+    */
+    template < typename TSpace, typename T, typename Functor, typename BinaryOperation >
+    T reduce( const HyperRectDomain< TSpace >& domain,
+              const typename TSpace::Point& lower,
+              const typename TSpace::Point& upper, T init,
+              Functor f, BinaryOperation op );
+
+    /**
+       Writes to out the points p of the domain such that pred( p ),
+       in the domain order. The predicate is evaluated in parallel,
+       the points are output sequentially.
+
+       @param domain any domain.
+       @param out an output iterator on points.
+       @param pred a predicate ( const Point& ) -> bool.
+       @return the output iterator after the last written point.
+    */
+    template < typename TSpace, typename OutputIterator, typename Predicate >
+    OutputIterator copyIf( const HyperRectDomain< TSpace >& domain,
+                           OutputIterator out, Predicate pred );
+
+    namespace detail
+    {
+      /**
+         Description of template class 'DomainPartition' <p> \brief
+         Aim: The partition of a box of a HyperRectDomain into chunks of
+         spans used by the parallel traversals.
+
+         When the box is the whole domain, each chunk is a single span
+         of whole rows. Otherwise, each span is a row of the box.
+      */
+      template < typename TSpace >
+      struct DomainPartition
+      {
+        typedef HyperRectDomain< TSpace >      Domain;
+        typedef typename TSpace::Point         Point;
+        typedef typename Domain::Size          Size;
+        static const Dimension dimension = TSpace::dimension;
+
+        /// Minimal number of points of a chunk.
+        static const Size min_chunk_size = 4096;
+
+        /**
+           Constructor.
+           @param domain any domain.
+           @param lower the lower bound of a box included in the domain.
+           @param upper the upper bound of a box included in the domain.
+           @param granularity when non zero, a divisor of the first
+           linear index of each span (whole domain only).
+        */
+        DomainPartition( const Domain& domain, const Point& lower,
+                         const Point& upper, Size granularity = 0 );
+
+        /// @return the number of chunks.
+        Size size() const;
+
+        /// Calls f( begin, end, first ) for each span of chunk c.
+        template < typename SpanFunctor >
+        void spans( Size c, SpanFunctor& f ) const;
+
+        /// Calls f( index, p ) for each point p of the span starting at first.
+        template < typename Functor >
+        void points( Size begin, Size end, Point first, Functor& f ) const;
+
+        /// The domain lower and upper bounds, and the box bounds.
+        Point myDomainLower, myDomainUpper, myLower, myUpper;
+        /// The number of points of the domain along each axis.
+        std::vector< Size > myExtent;
+        /// True when the box is the whole domain.
+        bool myWhole;
+        /// The number of points (whole) or rows (box) in each granule.
+        Size myGranule;
+        /// The total number of points (whole) or rows (box).
+        Size myNb;
+        /// The number of chunks.
+        Size myNbChunks;
+      };
+    } // namespace detail
+  } // namespace parallel
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/domains/ParallelDomainTraversal.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ParallelDomainTraversal_h
+
+#undef ParallelDomainTraversal_RECURSES
+#endif // else defined(ParallelDomainTraversal_RECURSES)
@@ -0,0 +1,526 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByBitmap.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module DigitalSetByBitmap.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByBitmap_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByBitmap.h
+#else // defined(DigitalSetByBitmap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByBitmap_RECURSES
+
+#if !defined DigitalSetByBitmap_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByBitmap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include <array>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/Clone.h"
+#include "DGtal/base/Bits.h"
+#include "DGtal/base/ContainerTraits.h"
+#include "DGtal/base/SetFunctions.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByBitmap
+  /**
+    Description of template class 'DigitalSetByBitmap' <p> \brief
+    Aim: Realizes the concept CDigitalSet by a bitmap over the whole
+    domain, i.e. one bit per domain point stored in 64-bit words.
+
+    Points are numbered as in the domain traversal (first axis
+    fastest). Membership, insertion and removal are constant time,
+    the memory usage is domain().size() / 8 bytes whatever the
+    number of points, and points are visited in the domain order by
+    skipping empty words. Unions, intersections, differences and
+    inclusion tests between sets with the same domain are computed
+    word by word, and their cardinality with popcount. These
+    operations are also those used by the set operations of
+    SetFunctions (functions::assignUnion, functions::setops, etc).
+
+    This representation is thus adequate for sets covering a
+    significant part of their domain (see WHOLE_DS in
+    DigitalSetSelector), e.g. thresholded images.
+
+    @tparam TDomain a HyperRectDomain.
+    @see CDigitalSet, DigitalSetSelector
+   */
+  template <typename TDomain>
+  class DigitalSetByBitmap
+  {
+  public:
+    typedef TDomain Domain;
+    typedef DigitalSetByBitmap<Domain> Self;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    typedef DGtal::uint64_t Word;
+    typedef std::vector<Word> Container;
+    static const Dimension dimension = Space::dimension;
+
+    /// The number of points stored in each word.
+    static const Size word_bits = 64;
+
+    /**
+       Iterator visiting the points of the set in the domain
+       order. Iterators remain valid while points are inserted or
+       removed, except the removed ones.
+    */
+    class ConstIterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef Point                     value_type;
+      typedef std::ptrdiff_t            difference_type;
+      typedef const Point*              pointer;
+      typedef const Point&              reference;
+
+      /// Default constructor (singular iterator).
+      ConstIterator() : mySet( 0 ), myIndex( 0 ) {}
+
+      /**
+         Constructor.
+         @param set the visited set.
+         @param index the index of a point of \a set, or the domain size for the end.
+      */
+      ConstIterator( const Self* set, Size index )
+        : mySet( set ), myIndex( index )
+      {
+        if ( myIndex < mySet->myNbPoints ) myPoint = mySet->pointOf( myIndex );
+      }
+
+      /// @return the pointed point.
+      reference operator*() const { return myPoint; }
+      /// @return a pointer to the pointed point.
+      pointer operator->() const { return &myPoint; }
+
+      /// Moves to the next point of the set.
+      ConstIterator& operator++()
+      {
+        myIndex = mySet->nextIndex( myIndex + 1 );
+        if ( myIndex < mySet->myNbPoints ) myPoint = mySet->pointOf( myIndex );
+        return *this;
+      }
+      /// Moves to the next point of the set. @return the previous iterator.
+      ConstIterator operator++( int )
+      {
+        ConstIterator tmp( *this );
+        ++( *this );
+        return tmp;
+      }
+      /// @return 'true' iff both iterators point to the same point.
+      bool operator==( const ConstIterator& other ) const { return myIndex == other.myIndex; }
+      /// @return 'true' iff both iterators point to different points.
+      bool operator!=( const ConstIterator& other ) const { return myIndex != other.myIndex; }
+
+      /// @return the index of the pointed point in the domain.
+      Size index() const { return myIndex; }
+
+    private:
+      /// The visited set.
+      const Self* mySet;
+      /// The index of the pointed point in the domain.
+      Size myIndex;
+      /// The pointed point.
+      Point myPoint;
+    };
+    typedef ConstIterator Iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByBitmap();
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any HyperRectDomain.
+     */
+    DigitalSetByBitmap( Clone<Domain> d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByBitmap ( const DigitalSetByBitmap & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitmap & operator= ( const DigitalSetByBitmap & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return a copy-on-write pointer on the embedding domain.
+     */
+    CowPtr<Domain> domainPointer() const;
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set (constant time).
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set. Same as insert.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set. Same as insert.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     * @pre it should point on a valid element ( it != end() ).
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return an iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return an iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return an iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * Give access to the underlying words.
+     * @return a const reference to the stored words.
+     */
+    const Container & container() const;
+
+    /**
+     * set union to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitmap<Domain> & operator+=
+    ( const DigitalSetByBitmap<Domain> & aSet );
+
+    // ----------------------- Set algebra --------------------------------------
+  public:
+
+    /**
+     * Updates this set as this \f$ \cup \f$ [aSet]. Word by word when
+     * both sets have the same domain, point by point otherwise.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    Self & assignUnion( const Self & aSet );
+
+    /**
+     * Updates this set as this \f$ \cap \f$ [aSet].
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    Self & assignIntersection( const Self & aSet );
+
+    /**
+     * Updates this set as this - [aSet].
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    Self & assignDifference( const Self & aSet );
+
+    /**
+     * Updates this set as this \f$ \Delta \f$ [aSet].
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    Self & assignSymmetricDifference( const Self & aSet );
+
+    /**
+     * @param aSet any other set.
+     * @return 'true' iff this set is a subset of [aSet].
+     */
+    bool isSubset( const Self & aSet ) const;
+
+    /**
+     * @param aSet any other set.
+     * @return 'true' iff this set and [aSet] have the same points.
+     */
+    bool isEqual( const Self & aSet ) const;
+
+    // ----------------------- Model of concepts::CPointPredicate -----------------------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set.
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const DigitalSetByBitmap<Domain> & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain. The pointed domain may be changed but it
+     * remains valid during the lifetime of the set.
+     */
+    CowPtr<Domain> myDomain;
+
+    /// The lower bound of the domain.
+    Point myLowerBound;
+
+    /// The number of points of the domain along each axis.
+    std::array<Size, dimension> myExtents;
+
+    /// The number of points of the domain.
+    Size myNbPoints;
+
+    /// The bits of the points, myNbPoints bits in all.
+    Container myWords;
+
+    /// The number of points of the set.
+    Size mySize;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByBitmap();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @return the index of the point \a p of the domain.
+    Size indexOf( const Point & p ) const;
+
+    /// @return the point of the domain of index \a i.
+    Point pointOf( Size i ) const;
+
+    /// @return the index of the first point of the set not before
+    /// index \a i, or myNbPoints if there is none.
+    Size nextIndex( Size i ) const;
+
+    /// @return 'true' iff \a other has the same domain, hence the same bit layout.
+    bool sameLayout( const Self & other ) const;
+
+    /// Clears the unused bits of the last word and counts the points.
+    void updateSize();
+
+  }; // end of class DigitalSetByBitmap
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByBitmap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByBitmap' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const DigitalSetByBitmap<Domain> & object );
+
+  /// Defines container traits for DigitalSetByBitmap<>: a set
+  /// ordered along the domain.
+  template <typename TDomain>
+  struct ContainerTraits< DigitalSetByBitmap<TDomain> >
+  {
+    typedef SetAssociativeCategory Category;
+  };
+
+  namespace detail {
+    /**
+     * Specializes set operations for DigitalSetByBitmap, which are
+     * computed word by word.
+     */
+    template <typename TDomain>
+    struct SetFunctionsImpl< DigitalSetByBitmap<TDomain>, true, true >
+    {
+      typedef DigitalSetByBitmap<TDomain> Container;
+      static bool isEqual( const Container& S1, const Container& S2 )
+      { return S1.isEqual( S2 ); }
+      static bool isSubset( const Container& S1, const Container& S2 )
+      { return S1.isSubset( S2 ); }
+      static Container& assignDifference( Container& S1, const Container& S2 )
+      { return S1.assignDifference( S2 ); }
+      static Container& assignUnion( Container& S1, const Container& S2 )
+      { return S1.assignUnion( S2 ); }
+      static Container& assignIntersection( Container& S1, const Container& S2 )
+      { return S1.assignIntersection( S2 ); }
+      static Container& assignSymmetricDifference( Container& S1, const Container& S2 )
+      { return S1.assignSymmetricDifference( S2 ); }
+    };
+  } // namespace detail
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByBitmap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByBitmap_h
+
+#undef DigitalSetByBitmap_RECURSES
+#endif // else defined(DigitalSetByBitmap_RECURSES)
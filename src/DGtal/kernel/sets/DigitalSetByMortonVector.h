@@ -0,0 +1,495 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByMortonVector.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module DigitalSetByMortonVector.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByMortonVector_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByMortonVector.h
+#else // defined(DigitalSetByMortonVector_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByMortonVector_RECURSES
+
+#if !defined DigitalSetByMortonVector_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByMortonVector_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/Clone.h"
+#include "DGtal/base/ContainerTraits.h"
+#include "DGtal/base/SetFunctions.h"
+#include "DGtal/kernel/NumberTraits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByMortonVector
+  /**
+    Description of template class 'DigitalSetByMortonVector' <p>
+    \brief Aim: Realizes the concept CDigitalSet by a compact vector
+    of points sorted along the Morton (Z-order) curve of the domain.
+
+    The Morton order is computed on coordinates relative to the lower
+    bound of the domain by comparing the most significant differing
+    bits of the coordinates, hence without building keys and whatever
+    the size of the domain. The memory usage is that of the points
+    only, consecutive points are close in space, membership tests are
+    binary searches, and unions, intersections, differences and
+    inclusion tests are linear merges which gallop (exponential
+    search) over long runs of points belonging to only one of the
+    sets, hence sub-linear when one set is much smaller than the
+    other. These merges are also used by the set operations of
+    SetFunctions (functions::assignUnion, functions::setops, etc).
+
+    Single insertions and removals are linear in the size of the
+    set, while inserting a range of points sorts and merges it at
+    once. This representation is thus adequate for sets that do not
+    change much but are iterated and combined often (see
+    MEDIUM_DS + LOW_VAR_DS + HIGH_ITER_DS in DigitalSetSelector).
+
+    @tparam TDomain a realization of the concept CDomain, with integer coordinates.
+    @see CDigitalSet, DigitalSetSelector
+   */
+  template <typename TDomain>
+  class DigitalSetByMortonVector
+  {
+  public:
+    typedef TDomain Domain;
+    typedef DigitalSetByMortonVector<Domain> Self;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    typedef typename Point::Coordinate Coordinate;
+    typedef std::vector<Point> Container;
+    typedef typename Container::const_iterator Iterator;
+    typedef typename Container::const_iterator ConstIterator;
+    static const Dimension dimension = Space::dimension;
+
+    /**
+       Strict weak ordering of points along the Morton curve whose
+       origin is a given point (the lower bound of the domain).
+    */
+    struct Compare
+    {
+      typedef typename NumberTraits<Coordinate>::UnsignedVersion Unsigned;
+
+      /// The origin of the Morton curve.
+      Point origin;
+
+      /// Constructor. @param o the origin of the curve.
+      Compare( const Point & o = Point() ) : origin( o ) {}
+
+      /**
+         @param p any point not before the origin.
+         @param q any point not before the origin.
+         @return 'true' iff \a p is before \a q along the Morton curve.
+      */
+      bool operator()( const Point & p, const Point & q ) const
+      {
+        // The axis of the most significant differing bit decides,
+        // ties going to the last axis as in a Morton key.
+        Dimension best = dimension - 1;
+        Unsigned  bestx = Unsigned( p[ best ] - origin[ best ] ) ^ Unsigned( q[ best ] - origin[ best ] );
+        for ( Dimension k = dimension - 1; k-- > 0; )
+          {
+            const Unsigned x = Unsigned( p[ k ] - origin[ k ] ) ^ Unsigned( q[ k ] - origin[ k ] );
+            if ( ( bestx < x ) && ( bestx < ( x ^ bestx ) ) )
+              {
+                best  = k;
+                bestx = x;
+              }
+          }
+        return Unsigned( p[ best ] - origin[ best ] ) < Unsigned( q[ best ] - origin[ best ] );
+      }
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByMortonVector();
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     */
+    DigitalSetByMortonVector( Clone<Domain> d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByMortonVector ( const DigitalSetByMortonVector & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByMortonVector & operator= ( const DigitalSetByMortonVector & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return a copy-on-write pointer on the embedding domain.
+     */
+    CowPtr<Domain> domainPointer() const;
+
+    /**
+     * @return the Morton order of the points of this set.
+     */
+    const Compare & compare() const;
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set (linear time).
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set. The new points are sorted then merged with the set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set. Same as insert.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set. Same as insert.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     * @pre it should point on a valid element ( it != end() ).
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return an iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return an iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return an iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * Give access to the underlying container.
+     * @return a const reference to the points, sorted by compare().
+     */
+    const Container & container() const;
+
+    /**
+     * set union to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByMortonVector<Domain> & operator+=
+    ( const DigitalSetByMortonVector<Domain> & aSet );
+
+    // ----------------------- Set algebra --------------------------------------
+  public:
+
+    /**
+     * Updates this set as this \f$ \cup \f$ [aSet] with a galloping merge.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    Self & assignUnion( const Self & aSet );
+
+    /**
+     * Updates this set as this \f$ \cap \f$ [aSet] with a galloping merge.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    Self & assignIntersection( const Self & aSet );
+
+    /**
+     * Updates this set as this - [aSet] with a galloping merge.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    Self & assignDifference( const Self & aSet );
+
+    /**
+     * Updates this set as this \f$ \Delta \f$ [aSet] with a galloping merge.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    Self & assignSymmetricDifference( const Self & aSet );
+
+    /**
+     * @param aSet any other set.
+     * @return 'true' iff this set is a subset of [aSet].
+     */
+    bool isSubset( const Self & aSet ) const;
+
+    /**
+     * @param aSet any other set.
+     * @return 'true' iff this set and [aSet] have the same points.
+     */
+    bool isEqual( const Self & aSet ) const;
+
+    // ----------------------- Model of concepts::CPointPredicate -----------------------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set.
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const DigitalSetByMortonVector<Domain> & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain. The pointed domain may be changed but it
+     * remains valid during the lifetime of the set.
+     */
+    CowPtr<Domain> myDomain;
+
+    /// The Morton order, whose origin is the lower bound of the domain.
+    Compare myCompare;
+
+    /// The points of the set, sorted by myCompare.
+    Container myVector;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByMortonVector();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       Exponential search followed by a binary search.
+       @return the first iterator in [first,last) whose point is not
+       before \a p, in time logarithmic in its distance to \a first.
+    */
+    ConstIterator gallop( ConstIterator first, ConstIterator last, const Point & p ) const;
+
+    /**
+       @param other any set.
+       @param tmp a buffer.
+       @return the points of \a other sorted by the order of this set,
+       i.e. its points or a sorted copy in \a tmp when both sets do
+       not have the same origin.
+    */
+    const Container & pointsOf( const Self & other, Container & tmp ) const;
+
+  }; // end of class DigitalSetByMortonVector
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByMortonVector'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByMortonVector' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const DigitalSetByMortonVector<Domain> & object );
+
+  /// Defines container traits for DigitalSetByMortonVector<>: a set
+  /// ordered along the Morton curve.
+  template <typename TDomain>
+  struct ContainerTraits< DigitalSetByMortonVector<TDomain> >
+  {
+    typedef SetAssociativeCategory Category;
+  };
+
+  namespace detail {
+    /**
+     * Specializes set operations for DigitalSetByMortonVector, which
+     * are computed with galloping merges.
+     */
+    template <typename TDomain>
+    struct SetFunctionsImpl< DigitalSetByMortonVector<TDomain>, true, true >
+    {
+      typedef DigitalSetByMortonVector<TDomain> Container;
+      static bool isEqual( const Container& S1, const Container& S2 )
+      { return S1.isEqual( S2 ); }
+      static bool isSubset( const Container& S1, const Container& S2 )
+      { return S1.isSubset( S2 ); }
+      static Container& assignDifference( Container& S1, const Container& S2 )
+      { return S1.assignDifference( S2 ); }
+      static Container& assignUnion( Container& S1, const Container& S2 )
+      { return S1.assignUnion( S2 ); }
+      static Container& assignIntersection( Container& S1, const Container& S2 )
+      { return S1.assignIntersection( S2 ); }
+      static Container& assignSymmetricDifference( Container& S1, const Container& S2 )
+      { return S1.assignSymmetricDifference( S2 ); }
+    };
+  } // namespace detail
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByMortonVector.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByMortonVector_h
+
+#undef DigitalSetByMortonVector_RECURSES
+#endif // else defined(DigitalSetByMortonVector_RECURSES)
@@ -48,9 +48,13 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+#include "DGtal/kernel/sets/DigitalSetByBitmap.h"
+#include "DGtal/kernel/sets/DigitalSetByMortonVector.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
 
 #include "DGtal/kernel/PointHashFunctions.h"
 #include <unordered_set>
+#include <type_traits>
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -62,6 +66,16 @@ namespace DGtal
   enum DigitalSetIterability { LOW_ITER_DS = 0, HIGH_ITER_DS = 8 };
   enum DigitalSetBelongTestability { LOW_BEL_DS = 0, HIGH_BEL_DS = 16 };
 
+  namespace detail
+  {
+    /// 'true' iff Domain is a HyperRectDomain, the only domain of DigitalSetByBitmap.
+    template <typename Domain>
+    struct IsHyperRectDomain : std::false_type {};
+
+    template <typename TSpace>
+    struct IsHyperRectDomain< HyperRectDomain<TSpace> > : std::true_type {};
+  } // namespace detail
+
   /////////////////////////////////////////////////////////////////////////////
   // template class DigitalSetSelector
   /**
@@ -83,6 +97,13 @@ namespace DGtal
    SpecificSet set1( domain );
    *
    * @endcode
+   *
+   * Sets of size WHOLE_DS of a HyperRectDomain are DigitalSetByBitmap
+   * (one bit per domain point), MEDIUM_DS + LOW_VAR_DS + HIGH_ITER_DS
+   * sets (with LOW_BEL_DS or HIGH_BEL_DS) are DigitalSetByMortonVector,
+   * SMALL_DS + LOW_VAR_DS + LOW_BEL_DS sets (with LOW_ITER_DS or
+   * HIGH_ITER_DS) are DigitalSetBySTLVector, and other sets are
+   * DigitalSetByAssociativeContainer over std::unordered_set.
    */
   template <typename Domain, int Preferences >
   struct DigitalSetSelector
@@ -91,7 +112,10 @@ namespace DGtal
     /**
      * Adequate digital set representation for the given preferences.
      */
-    typedef DigitalSetByAssociativeContainer<Domain, std::unordered_set< typename Domain::Point> > Type;
+    typedef typename std::conditional
+    < ( ( Preferences & WHOLE_DS ) == WHOLE_DS ) && detail::IsHyperRectDomain<Domain>::value,
+      DigitalSetByBitmap<Domain>,
+      DigitalSetByAssociativeContainer<Domain, std::unordered_set< typename Domain::Point> > >::type Type;
   }; // end of class DigitalSetSelector
 
 
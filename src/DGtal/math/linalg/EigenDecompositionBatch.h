@@ -0,0 +1,260 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file EigenDecompositionBatch.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module EigenDecompositionBatch.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(EigenDecompositionBatch_RECURSES)
+#error Recursive header files inclusion detected in EigenDecompositionBatch.h
+#else // defined(EigenDecompositionBatch_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define EigenDecompositionBatch_RECURSES
+
+#if !defined EigenDecompositionBatch_h
+/** Prevents repeated inclusion of headers. */
+#define EigenDecompositionBatch_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Instrumentation.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/math/linalg/SimpleMatrix.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // template class EigenDecompositionBatch
+  /**
+   * Description of template class 'EigenDecompositionBatch' <p> \brief
+   * Aim: Computes the eigen decomposition of many small symmetric
+   * matrices at once (typically 2x2 or 3x3 covariance matrices, one
+   * per surfel or per point).
+   *
+   * The matrices are stored in structure-of-arrays layout: one array
+   * per coefficient of the upper triangle, and the eigenvalues and
+   * eigenvectors are returned the same way. They are diagonalized by
+   * blocks of \ref blockSize matrices with the cyclic Jacobi method,
+   * whose rotations are computed without branches, so that the
+   * innermost loops run across the matrices of a block and are
+   * vectorized by the compiler. Blocks are processed in parallel when
+   * OpenMP is available.
+   *
+   * As in EigenDecomposition, eigenvalues are sorted in ascending
+   * order and eigenvectors are the columns of the eigenvector matrix.
+   * Since eigenvectors are only defined up to their sign, the ones
+   * computed here may be opposite to the ones of EigenDecomposition.
+   *
+   * @code
+   * EigenDecompositionBatch<3,double> batch( matrices.size() );
+   * for ( std::size_t k = 0; k < matrices.size(); ++k )
+   *   batch.setMatrix( k, matrices[ k ] );
+   * batch.compute();
+   * for ( std::size_t k = 0; k < matrices.size(); ++k )
+   *   batch.getEigenVectors( k, vectors[ k ] );
+   * @endcode
+   *
+   * @tparam TN the size TN of the matrices TN x TN.
+   *
+   * @tparam TComponent the type of each component of the matrices,
+   * some double or float type.
+   *
+   * @tparam TMatrix a model of CMatrix, for instance SimpleMatrix.
+   *
+   * @see EigenDecomposition
+   */
+  template  <DGtal::Dimension TN, typename TComponent, typename TMatrix=SimpleMatrix<TComponent, TN, TN> >
+  class EigenDecompositionBatch
+  {
+    BOOST_STATIC_ASSERT(TN > 0 );
+
+    // ----------------------- Public types -----------------------------------
+  public:
+    typedef TComponent Component;                    ///< the type of each coefficient, i.e. scalar
+    typedef PointVector<TN,Component>   Vector;      ///< the type for column vectors (Nx1)
+    typedef TMatrix                     Matrix;      ///< the type for matrices (NxN)
+
+    // ----------------------- Static constants ------------------------------
+  public:
+    /// Usual static constant for dimension.
+    static const DGtal::Dimension dimension = TN;
+    /// Number of coefficients of the upper triangle of a matrix.
+    static const DGtal::Dimension nbCoefficients = TN * ( TN + 1 ) / 2;
+    /// Number of matrices diagonalized together.
+    static const std::size_t blockSize = 64;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param n the number of matrices.
+     */
+    explicit EigenDecompositionBatch( std::size_t n = 0 );
+
+    /**
+     * Changes the number of matrices. The coefficients of the
+     * matrices already stored are kept.
+     * @param n the number of matrices.
+     */
+    void resize( std::size_t n );
+
+    /// @return the number of matrices.
+    std::size_t size() const;
+
+    /**
+     * Stores a matrix. Only its upper triangle is read.
+     * @param k the index of the matrix.
+     * @param m a symmetric matrix.
+     */
+    void setMatrix( std::size_t k, const Matrix & m );
+
+    /**
+     * @param i a row index.
+     * @param j a column index.
+     * @return the array of the coefficients (i,j) (or (j,i)) of all matrices.
+     */
+    Component* coefficients( Dimension i, Dimension j );
+
+    /**
+     * Computes the eigenvalues and eigenvectors of all matrices.
+     */
+    void compute();
+
+    /**
+     * @param i the index of an eigenvalue, in ascending order.
+     * @return the array of the i-th eigenvalues of all matrices.
+     */
+    const Component* eigenValues( Dimension i ) const;
+
+    /**
+     * @param i the index of a component.
+     * @param j the index of an eigenvalue, in ascending order.
+     * @return the array of the i-th components of the eigenvectors
+     * associated with the j-th eigenvalues of all matrices.
+     */
+    const Component* eigenVectors( Dimension i, Dimension j ) const;
+
+    /**
+     * @param k the index of a matrix.
+     * @param[out] eigenValues the eigenvalues of the matrix k, in ascending order.
+     */
+    void getEigenValues( std::size_t k, Vector & eigenValues ) const;
+
+    /**
+     * @param k the index of a matrix.
+     * @param[out] eigenVectors the eigenvectors of the matrix k, in columns.
+     */
+    void getEigenVectors( std::size_t k, Matrix & eigenVectors ) const;
+
+    /**
+     * Computes the eigen decomposition of one matrix with the same
+     * method, e.g. when a single matrix is needed and results have to
+     * be consistent with the ones of a batch.
+     *
+     * @param[in]  matrix        a symmetric matrix.
+     * @param[out] eigenVectors  matrix of eigenvectors. Eigenvectors are put in column.
+     * @param[out] eigenValues   vector of eigenvalues, sorted in ascending order.
+     */
+    static void getEigenDecomposition( const Matrix & matrix, Matrix & eigenVectors, Vector & eigenValues );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The number of matrices.
+    std::size_t mySize;
+    /// The coefficients of the upper triangle of the matrices.
+    std::vector<Component> myCoefficients[ nbCoefficients ];
+    /// The eigenvalues of the matrices.
+    std::vector<Component> myValues[ TN ];
+    /// The eigenvectors of the matrices, row after row.
+    std::vector<Component> myVectors[ TN * TN ];
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param i a row index.
+     * @param j a column index.
+     * @return the index of the coefficient (i,j) in the upper triangle.
+     */
+    static Dimension index( Dimension i, Dimension j );
+
+    /**
+     * Diagonalizes \a len matrices with the cyclic Jacobi method and
+     * sorts their eigenvalues.
+     *
+     * @tparam B the capacity of the arrays.
+     * @param[in,out] a \b input: the coefficients of the matrices /
+     * \b output: their eigenvalues on the diagonal.
+     * @param[out] v the eigenvectors of the matrices, in columns.
+     * @param len the number of matrices.
+     */
+    template <std::size_t B>
+    static void decompose( Component a[][ B ], Component v[][ B ], std::size_t len );
+
+  }; // end of class EigenDecompositionBatch
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'EigenDecompositionBatch'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'EigenDecompositionBatch' to write.
+   * @return the output stream after the writing.
+   */
+  template <DGtal::Dimension TN, typename TComponent, typename TMatrix>
+  std::ostream&
+  operator<< ( std::ostream & out, const EigenDecompositionBatch<TN, TComponent, TMatrix> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/math/linalg/EigenDecompositionBatch.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined EigenDecompositionBatch_h
+
+#undef EigenDecompositionBatch_RECURSES
+#endif // else defined(EigenDecompositionBatch_RECURSES)
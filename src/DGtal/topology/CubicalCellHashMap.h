@@ -0,0 +1,463 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CubicalCellHashMap.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module CubicalCellHashMap.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CubicalCellHashMap_RECURSES)
+#error Recursive header files inclusion detected in CubicalCellHashMap.h
+#else // defined(CubicalCellHashMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CubicalCellHashMap_RECURSES
+
+#if !defined CubicalCellHashMap_h
+/** Prevents repeated inclusion of headers. */
+#define CubicalCellHashMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <algorithm>
+#include <vector>
+#include <utility>
+#include <memory>
+#include <limits>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ContainerTraits.h"
+#include "DGtal/kernel/NumberTraits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CubicalCellHash
+  /**
+    Description of template class 'CubicalCellHash' <p> \brief Aim:
+    A hash function for Khalimsky cells that packs the Khalimsky
+    coordinates of the cell into a 64-bit key (64/dim bits per
+    coordinate, folded by rotation beyond) and then mixes it so that
+    the low bits are well spread, as required by open addressing
+    with power-of-two tables.
+
+    @tparam TCell the type of cell, e.g. KhalimskyCell.
+  */
+  template <typename TCell>
+  struct CubicalCellHash
+  {
+    typedef TCell Cell;
+    typedef typename Cell::Point Point;
+    typedef typename Point::Coordinate Integer;
+
+    /**
+       @param c any cell.
+       @return the hash value of \a c.
+    */
+    std::size_t operator()( const Cell& c ) const;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CubicalCellHashMap
+  /**
+    Description of template class 'CubicalCellHashMap' <p> \brief
+    Aim: An associative container Cell -> Data stored in a flat
+    open-addressing hash table, adequate as cell container for
+    CubicalComplex (second template parameter) when complexes are
+    big.
+
+    Cells and their data are stored contiguously in a table whose
+    capacity is a power of two, and collisions are resolved by linear
+    probing. A parallel array of one control byte per slot tells
+    whether the slot is empty, erased or full, and in the latter case
+    stores 7 bits of the hash value so that most mismatching slots
+    are rejected without comparing cells. Compared to the default
+    std::map, the memory used per cell is about the size of the pair
+    (cell, data) divided by the load factor (at most 7/8), instead of
+    the pair plus three pointers and a color per tree node, and
+    lookups do not chase pointers.
+
+    Erasing a cell leaves a tombstone, so that erasing never moves
+    other cells: iterators to other cells stay valid, as required by
+    functions::collapse, which erases cells while holding iterators on
+    the remaining ones. Insertions may rehash the table, and thus
+    invalidate iterators, exactly like std::unordered_map.
+
+    It is a model of boost::ForwardContainer, of
+    concepts::CSTLAssociativeContainer and of a unique pair
+    associative container (see ContainerTraits), and offers the usual
+    services of std::unordered_map (find, count, insert, erase,
+    operator[], reserve).
+
+    @code
+    typedef KhalimskySpaceND< 3, int > KSpace;
+    typedef CubicalCellHashMap< KSpace::Cell, CubicalCellData > CellContainer;
+    typedef CubicalComplex< KSpace, CellContainer > CC;
+    @endcode
+
+    @tparam TCell the type of the keys, i.e. cells.
+    @tparam TData the type of the mapped values.
+    @tparam THash the hash function, CubicalCellHash by default.
+  */
+  template < typename TCell, typename TData,
+             typename THash = CubicalCellHash< TCell > >
+  class CubicalCellHashMap
+  {
+  public:
+    typedef CubicalCellHashMap< TCell, TData, THash > Self;
+    typedef TCell                                  key_type;
+    typedef TData                                  mapped_type;
+    typedef std::pair< const TCell, TData >        value_type;
+    typedef THash                                  hasher;
+    typedef std::equal_to< TCell >                 key_equal;
+    typedef std::size_t                            size_type;
+    typedef std::ptrdiff_t                         difference_type;
+    typedef value_type&                            reference;
+    typedef const value_type&                      const_reference;
+    typedef value_type*                            pointer;
+    typedef const value_type*                      const_pointer;
+
+  private:
+    /// Raw storage for one slot of the table.
+    typedef typename std::aligned_storage< sizeof( value_type ),
+                                           alignof( value_type ) >::type Slot;
+    /// Control byte of an empty slot.
+    static const uint8_t EMPTY = 0x80;
+    /// Control byte of an erased slot (tombstone).
+    static const uint8_t ERASED = 0xFE;
+
+    /// Forward iterator on full slots.
+    template < typename TValue, typename TMap >
+    class SlotIterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef typename std::remove_const< TValue >::type value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef TValue* pointer;
+      typedef TValue& reference;
+
+      SlotIterator() : myMap( 0 ), myIdx( 0 ) {}
+      SlotIterator( TMap* map, size_type idx ) : myMap( map ), myIdx( idx ) {}
+      /// Conversion from iterator to const_iterator.
+      template < typename TOtherValue, typename TOtherMap >
+      SlotIterator( const SlotIterator< TOtherValue, TOtherMap >& other )
+        : myMap( other.myMap ), myIdx( other.myIdx ) {}
+
+      reference operator*() const { return myMap->slot( myIdx ); }
+      pointer operator->() const { return &( myMap->slot( myIdx ) ); }
+      SlotIterator& operator++()
+      {
+        myIdx = myMap->nextFull( myIdx + 1 );
+        return *this;
+      }
+      SlotIterator operator++( int )
+      {
+        SlotIterator tmp( *this );
+        ++( *this );
+        return tmp;
+      }
+      template < typename TOtherValue, typename TOtherMap >
+      bool operator==( const SlotIterator< TOtherValue, TOtherMap >& other ) const
+      { return myIdx == other.myIdx; }
+      template < typename TOtherValue, typename TOtherMap >
+      bool operator!=( const SlotIterator< TOtherValue, TOtherMap >& other ) const
+      { return myIdx != other.myIdx; }
+
+    private:
+      template < typename TOtherValue, typename TOtherMap >
+      friend class SlotIterator;
+      friend class CubicalCellHashMap;
+      TMap* myMap;
+      size_type myIdx;
+    };
+
+  public:
+    typedef SlotIterator< value_type, Self >             iterator;
+    typedef SlotIterator< const value_type, const Self > const_iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Default constructor. The container is empty.
+    CubicalCellHashMap();
+
+    /**
+       Constructor of an empty container able to store \a n cells
+       without rehashing.
+       @param n the expected number of cells.
+    */
+    explicit CubicalCellHashMap( size_type n );
+
+    /**
+       Copy constructor.
+       @param other the object to clone.
+    */
+    CubicalCellHashMap( const CubicalCellHashMap& other );
+
+    /**
+       Move constructor.
+       @param other the object to move, left empty.
+    */
+    CubicalCellHashMap( CubicalCellHashMap&& other );
+
+    /// Destructor.
+    ~CubicalCellHashMap();
+
+    /**
+       Assignment.
+       @param other the object to copy.
+       @return a reference on 'this'.
+    */
+    CubicalCellHashMap& operator=( const CubicalCellHashMap& other );
+
+    /**
+       Move assignment.
+       @param other the object to move, left empty.
+       @return a reference on 'this'.
+    */
+    CubicalCellHashMap& operator=( CubicalCellHashMap&& other );
+
+    /**
+       Swaps the content of this container with \a other in constant time.
+       @param other any other container.
+    */
+    void swap( CubicalCellHashMap& other );
+
+    // ----------------------- Container services -----------------------------
+  public:
+
+    /// @return the number of cells.
+    size_type size() const;
+    /// @return 'true' iff the container has no cell.
+    bool empty() const;
+    /// @return the maximal number of cells.
+    size_type max_size() const;
+    /// @return the number of slots of the table.
+    size_type capacity() const;
+
+    /// @return an iterator on the first cell.
+    iterator begin();
+    /// @return an iterator after the last cell.
+    iterator end();
+    /// @return a const iterator on the first cell.
+    const_iterator begin() const;
+    /// @return a const iterator after the last cell.
+    const_iterator end() const;
+
+    /**
+       Grows the table so that \a n cells may be stored without
+       rehashing. Invalidates iterators if the table is rehashed.
+       @param n the expected number of cells.
+    */
+    void reserve( size_type n );
+
+    /// Removes all the cells, keeping the table capacity.
+    void clear();
+
+    // ----------------------- Associative services ---------------------------
+  public:
+
+    /**
+       @param key any cell.
+       @return an iterator on the pair (key, data) or end() if \a key
+       is not in the container.
+    */
+    iterator find( const key_type& key );
+
+    /**
+       @param key any cell.
+       @return a const iterator on the pair (key, data) or end() if
+       \a key is not in the container.
+    */
+    const_iterator find( const key_type& key ) const;
+
+    /**
+       @param key any cell.
+       @return 1 if \a key is in the container, 0 otherwise.
+    */
+    size_type count( const key_type& key ) const;
+
+    /**
+       @param key any cell.
+       @return the range of the pairs with key \a key (zero or one).
+    */
+    std::pair< iterator, iterator > equal_range( const key_type& key );
+
+    /**
+       @param key any cell.
+       @return the range of the pairs with key \a key (zero or one).
+    */
+    std::pair< const_iterator, const_iterator > equal_range( const key_type& key ) const;
+
+    /**
+       Inserts the pair \a value if its key is not already in the container.
+       @param value any pair (cell, data).
+       @return an iterator on the pair with this key and 'true' iff
+       \a value was inserted.
+    */
+    std::pair< iterator, bool > insert( const value_type& value );
+
+    /**
+       Inserts the pair \a value if its key is not already in the
+       container. The hint is ignored.
+       @param value any pair (cell, data).
+       @return an iterator on the pair with this key.
+    */
+    iterator insert( const_iterator /* hint */, const value_type& value );
+
+    /**
+       Inserts the pairs of the range [first,last).
+       @tparam InputIterator any input iterator on pairs (cell, data).
+       @param first the beginning of the range.
+       @param last the end of the range.
+    */
+    template < typename InputIterator >
+    void insert( InputIterator first, InputIterator last );
+
+    /**
+       @param key any cell.
+       @return a reference on the data associated to \a key, inserted
+       with a default data if \a key was not in the container.
+    */
+    mapped_type& operator[]( const key_type& key );
+
+    /**
+       Erases the pair pointed by \a position. Other iterators stay valid.
+       @param position any valid iterator of this container.
+       @return an iterator on the next pair.
+    */
+    iterator erase( const_iterator position );
+
+    /**
+       Erases the pairs of the range [first,last).
+       @param first the beginning of the range.
+       @param last the end of the range.
+       @return \a last.
+    */
+    iterator erase( const_iterator first, const_iterator last );
+
+    /**
+       Erases the pair with key \a key, if any.
+       @param key any cell.
+       @return the number of erased pairs (zero or one).
+    */
+    size_type erase( const key_type& key );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The slots of the table, whose number is a power of two (or zero).
+    std::unique_ptr< Slot[] > mySlots;
+    /// The control bytes of the slots (EMPTY, ERASED or 7 bits of the hash).
+    std::vector< uint8_t > myCtrl;
+    /// The number of cells.
+    size_type mySize;
+    /// The number of erased slots.
+    size_type myErased;
+    /// The hash function.
+    hasher myHash;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /// @return the value stored in slot \a i, which must be full.
+    value_type& slot( size_type i );
+    /// @return the value stored in slot \a i, which must be full.
+    const value_type& slot( size_type i ) const;
+    /// @return the first full slot with index not smaller than \a i, or capacity().
+    size_type nextFull( size_type i ) const;
+    /// @return the index of the slot of \a key or capacity() if it is absent.
+    size_type findIndex( const key_type& key ) const;
+    /**
+       @param key any cell.
+       @param[out] h2 the 7 bits of the hash of \a key stored in the control bytes.
+       @return the slot of \a key and 'true' if the key was already
+       present, otherwise a free slot for \a key and 'false'. Grows
+       the table only if \a key is absent and needs an empty slot.
+    */
+    std::pair< size_type, bool > findOrPrepare( const key_type& key, uint8_t& h2 );
+    /**
+       Constructs \a value in the free slot \a i and marks it as full.
+       @param i a free slot returned by findOrPrepare.
+       @param h2 the 7 bits of the hash of the key of \a value.
+       @param value any pair (cell, data).
+    */
+    void construct( size_type i, uint8_t h2, const value_type& value );
+    /// Moves all the cells to a new table of \a n slots (a power of two).
+    void rehash( size_type n );
+    /// Destroys all the cells and frees the table.
+    void destroy();
+    /// Copies the cells of \a other, into an empty table of the same capacity.
+    void copyFrom( const CubicalCellHashMap& other );
+  }; // end of class CubicalCellHashMap
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'CubicalCellHashMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'CubicalCellHashMap' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TCell, typename TData, typename THash >
+  std::ostream&
+  operator<< ( std::ostream & out, const CubicalCellHashMap< TCell, TData, THash > & object );
+
+  /// Defines container traits for CubicalCellHashMap<>.
+  template < typename TCell, typename TData, typename THash >
+  struct ContainerTraits< CubicalCellHashMap< TCell, TData, THash > >
+  {
+    typedef UnorderedMapAssociativeCategory Category;
+  };
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/CubicalCellHashMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CubicalCellHashMap_h
+
+#undef CubicalCellHashMap_RECURSES
+#endif // else defined(CubicalCellHashMap_RECURSES)
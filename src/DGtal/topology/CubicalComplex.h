@@ -52,6 +52,7 @@
 #include "DGtal/base/ContainerTraits.h"
 #include "DGtal/base/CSTLAssociativeContainer.h"
 #include "DGtal/topology/CCellularGridSpaceND.h"
+#include "DGtal/topology/CubicalCellHashMap.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -167,7 +168,9 @@ namespace DGtal
   * it. It could be for instance a std::map or a
   * std::unordered_map. Note that unfortunately, unordered_map are
   * (strangely) not models of boost::AssociativeContainer, hence we
-  * cannot check concepts here.
+  * cannot check concepts here. For big complexes, prefer
+  * CubicalCellHashMap, a flat hash table that uses much less memory
+  * per cell than std::map and has faster lookups.
   *
   */
   template < typename TKSpace,
@@ -1210,6 +1213,10 @@ namespace DGtal
     * is (locally around \a S) closed, so this speeds up this method, otherwise, the
     * complex may be arbitrary.
     * @return the closure of \a S within this complex as a cubical complex.
+    *
+    * @note Faces are computed by blocks of cells of \a S, in parallel
+    * when OpenMP is available, and deduplicated by sorting per
+    * thread before being inserted.
     */
     CubicalComplex closure( const CubicalComplex& S, bool hintClosed = false ) const;
 
@@ -1222,6 +1229,8 @@ namespace DGtal
     * is (locally around \a S) open, so this speeds up this method, otherwise, the
     * complex may be arbitrary.
     * @return the star of \a S within this complex as a cubical complex.
+    *
+    * @note Cofaces are computed like faces in closure.
     */
     CubicalComplex star( const CubicalComplex& S, bool hintOpen = false ) const;
 
@@ -1252,6 +1261,9 @@ namespace DGtal
     /**
     * Close all cells of dimension less or equal to \a k.
     * @param k any strictly positive integer.
+    *
+    * @note Direct faces are computed dimension per dimension like
+    * faces in closure.
     */
     void close( Dimension k );
 
@@ -1307,6 +1319,42 @@ namespace DGtal
 
   private:
 
+    /// The kind of incident cells inserted by insertIncidentCells.
+    enum Incidence { Faces, CoFaces, DirectFaces };
+
+    /// @return the cell \a c itself.
+    static const Cell& cellOf( const Cell& c ) { return c; }
+    /// @return the cell of the pair \a v of a CellMap.
+    static const Cell& cellOf( const typename CellMap::value_type& v ) { return v.first; }
+
+    /**
+     * Inserts into \a target the incident cells of the cells in the
+     * range [it,itE), i.e. their faces within this complex
+     * (cellBoundary), their cofaces within this complex
+     * (cellCoBoundary) or their direct faces in the space
+     * (KSpace::uLowerIncident) according to \a incidence. The range
+     * is processed by blocks of cells, whose incident cells are
+     * computed in parallel over slices of the block when OpenMP is
+     * available. With several threads, each thread deduplicates its
+     * cells by sorting them per dimension before inserting them in
+     * \a target, which is done by one thread at a time. Existing
+     * cells keep their data, except for DirectFaces where the data
+     * is reset as in insertCell.
+     *
+     * @tparam CellIterator an iterator on cells or on pairs (cell, data).
+     * @param target the complex where incident cells are inserted,
+     * which must not be the one visited by [it,itE) unless the
+     * inserted cells have another dimension than the visited ones.
+     * @param it an iterator on the first cell.
+     * @param itE an iterator after the last cell.
+     * @param incidence the kind of incident cells.
+     * @param hint the hint passed to cellBoundary or cellCoBoundary.
+     */
+    template <typename CellIterator>
+    void insertIncidentCells( CubicalComplex& target,
+                              CellIterator it, CellIterator itE,
+                              Incidence incidence, bool hint ) const;
+
 
     // ------------------------- Internals ------------------------------------
   private:
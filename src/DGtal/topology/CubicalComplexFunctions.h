@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/topology/CubicalComplex.h"
 #include <DGtal/topology/helpers/NeighborhoodConfigurationsHelper.h>
@@ -398,6 +399,84 @@ namespace DGtal
                        bool hintIsSClosed = false, bool hintIsKClosed = false,
                        bool verbose = false );
 
+    /// Statistics of one pass of parallelCollapse, i.e. the
+    /// processing of the cells put in the priority queue at its
+    /// beginning.
+    struct CollapsePassStatistics {
+      /// Number of cells in the priority queue at the beginning of the pass.
+      uint64_t nbCandidates;
+      /// Number of cells popped from the priority queue.
+      uint64_t nbExamined;
+      /// Number of rounds, i.e. of batches of cells examined concurrently.
+      uint64_t nbRounds;
+      /// Number of free pairs removed.
+      uint64_t nbPairs;
+      /// Number of free pairs dropped because their maximal cell was
+      /// removed by another pair of the same round.
+      uint64_t nbConflicts;
+      /// Duration of the pass in milliseconds.
+      double time;
+
+      inline CollapsePassStatistics()
+        : nbCandidates( 0 ), nbExamined( 0 ), nbRounds( 0 ),
+          nbPairs( 0 ), nbConflicts( 0 ), time( 0.0 ) {}
+    };
+
+    /**
+     * Collapse a user-specified part of complex \a K like
+     * functions::collapse, but removes free pairs concurrently. Cells
+     * are popped from a priority queue ordered by \a priority by
+     * rounds of \a batchSize cells. The free pairs (c,d) of the cells
+     * of a round are looked for in parallel (OpenMP), then removed
+     * in priority order unless their maximal cell c has already been
+     * removed in this round. Removing a free pair only removes
+     * cofaces of other cells, hence the pairs with distinct maximal
+     * cells are independent and removing one leaves the others
+     * free. The cells of dropped pairs are faces of a removed cell
+     * and are examined again at the next pass.
+     *
+     * The resulting complex keeps the same homotopy type. It does not
+     * depend on the number of threads, but may differ from the one
+     * of functions::collapse since pairs of a round are found before
+     * any of them is removed.
+     *
+     * @note Cells whose data has been marked as FIXED are not
+     * removed, and only cells that are in the closure of [\a S_itb,\a
+     * S_itE) may be removed.
+     *
+     * @tparam TKSpace the digital space in which lives the cubical complex.
+     * @tparam TCellContainer the associative container used to store cells within the cubical complex.
+     *
+     * @tparam CellConstIterator any forward const iterator on Cell.
+     *
+     * @tparam CellMapIteratorPriority any type defining a method 'bool
+     * operator()( const CellMapIterator&, const CellMapIterator&) const'. Defines the order
+     * in which cells are collapsed. @see DefaultCellMapIteratorPriority
+     *
+     * @param[in,out] K the complex that is collapsed (a CubicalComplex
+     * or a VoxelComplex).
+     * @param S_itB the start of a range of cells which is included in [K].
+     * @param S_itE the end of a range of cells which is included in [K].
+     * @param priority the object that assign a priority to each cell.
+     * @param hintIsSClosed indicates if [\a S_itb,\a S_ite) is a closed set (faster in this case).
+     * @param hintIsKClosed indicates that complex \a K is closed.
+     * @param[out] statistics when not null, the statistics of each
+     * pass are appended to this vector.
+     * @param batchSize the maximal number of cells examined in a round.
+     * @param verbose outputs some information during processing when 'true'.
+     * @return the number of cells removed from complex \a K.
+     */
+    template <typename TKSpace, typename TCellContainer,
+              typename CellConstIterator,
+              typename CellMapIteratorPriority >
+    uint64_t parallelCollapse( CubicalComplex< TKSpace, TCellContainer > & K,
+                               CellConstIterator S_itB, CellConstIterator S_itE,
+                               const CellMapIteratorPriority& priority,
+                               bool hintIsSClosed = false, bool hintIsKClosed = false,
+                               std::vector< CollapsePassStatistics >* statistics = 0,
+                               std::size_t batchSize = 4096,
+                               bool verbose = false );
+
     /**
      * Computes the cells of the given complex \a K that lies on the
      * boundary or inside the parallelepiped specified by bounds \a
@@ -31,8 +31,10 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <atomic>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CountedPtr.h"
+#include "DGtal/base/CowPtr.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -211,6 +213,72 @@ bool testCountedPtrMemory()
   return nb == nbok;
 }
 
+/// An object that counts its instances, whatever the thread.
+struct B {
+  B( int _b ) : b( _b ) { ++nb; }
+  B( const B& other ) : b( other.b ) { ++nb; }
+  ~B() { --nb; }
+  static std::atomic<int> nb;
+  int b;
+};
+
+std::atomic<int> B::nb( 0 );
+
+bool testCountedPtrThreads()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  const long n = 100000;
+  trace.beginBlock ( "Testing CountedPtr and CowPtr shared by threads..." );
+
+  trace.beginBlock ( "CountedPtr may be copied and freed concurrently." );
+  {
+    CountedPtr<B> cptr( new B( 3 ) );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for ( long i = 0; i < n; ++i )
+      {
+        CountedPtr<B> local = cptr;
+        CountedPtr<B> other( local );
+        local = CountedPtr<B>();
+        local = other;
+      }
+    ++nb; nbok += B::nb == 1 ? 1 : 0;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "B::nb == 1" << std::endl;
+    ++nb; nbok += cptr.count() == 1 ? 1 : 0;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "cptr.count() == 1" << std::endl;
+  }
+  ++nb; nbok += B::nb == 0 ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") " << "B::nb == 0" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "CowPtr may be detached concurrently." );
+  {
+    CowPtr<B> cow( new B( 7 ) );
+    long nbErrors = 0;
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static) reduction(+:nbErrors)
+#endif
+    for ( long i = 0; i < n / 100; ++i )
+      {
+        CowPtr<B> local = cow;
+        local->b = (int) i; // detaches local from cow
+        nbErrors += ( local->b == (int) i ) ? 0 : 1;
+      }
+    ++nb; nbok += nbErrors == 0 ? 1 : 0;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "nbErrors == 0" << std::endl;
+    ++nb; nbok += ( B::nb == 1 && cow.count() == 1 && cow.get()->b == 7 ) ? 1 : 0;
+    trace.info() << "(" << nbok << "/" << nb << ") "
+                 << "B::nb == 1 && cow.count() == 1 && cow.get()->b == 7" << std::endl;
+  }
+  ++nb; nbok += B::nb == 0 ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") " << "B::nb == 0" << std::endl;
+  trace.endBlock();
+
+  trace.endBlock();
+  return nb == nbok;
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
@@ -225,7 +293,8 @@ int main( int argc, char** argv )
 
   bool res = testCountedPtr()
     && testCountedPtrCopy()
-    && testCountedPtrMemory();
+    && testCountedPtrMemory()
+    && testCountedPtrThreads();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,197 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testInstrumentation.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class Instrumentation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Instrumentation.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class Instrumentation.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Some computation, so that scopes last.
+double work( unsigned int n )
+{
+  double s = 0.0;
+  for ( unsigned int i = 1; i <= n; ++i ) s += 1.0 / (double) i;
+  return s;
+}
+
+TEST_CASE( "Testing Instrumentation" )
+{
+  Instrumentation::reset();
+
+  SECTION( "Nothing is recorded while disabled" )
+    {
+      REQUIRE( ! Instrumentation::isEnabled() );
+      {
+        DGTAL_INSTRUMENT_SCOPE( "disabled" );
+        DGTAL_INSTRUMENT_COUNT( "disabled counter", 1 );
+        work( 1000 );
+      }
+      REQUIRE( Instrumentation::timers().empty() );
+      REQUIRE( Instrumentation::counters().empty() );
+    }
+
+  SECTION( "Nested scopes are named by their path" )
+    {
+      Instrumentation::enable( true );
+      double s = 0.0;
+      {
+        DGTAL_INSTRUMENT_SCOPE( "outer" );
+        for ( unsigned int i = 0; i < 3; ++i )
+          {
+            DGTAL_INSTRUMENT_SCOPE( "inner" );
+            s += work( 10000 );
+          }
+      }
+      Instrumentation::disable();
+      REQUIRE( s > 0.0 );
+      const Instrumentation::Timers timers = Instrumentation::timers();
+      REQUIRE( timers.size() == 2 );
+      REQUIRE( timers.count( "outer" ) == 1 );
+      REQUIRE( timers.count( "outer/inner" ) == 1 );
+      const Instrumentation::TimerStatistics & outer = timers.find( "outer" )->second;
+      const Instrumentation::TimerStatistics & inner = timers.find( "outer/inner" )->second;
+      REQUIRE( outer.nbCalls == 1 );
+      REQUIRE( inner.nbCalls == 3 );
+      REQUIRE( inner.min <= inner.max );
+      REQUIRE( inner.total <= outer.total );
+      const Instrumentation::Events events = Instrumentation::events();
+      REQUIRE( events.size() == 4 );
+      REQUIRE( events[ 0 ].name == "outer" );
+      REQUIRE( events[ 1 ].name == "outer/inner" );
+      REQUIRE( events[ 0 ].start <= events[ 1 ].start );
+    }
+
+  SECTION( "Counters of all threads are merged" )
+    {
+      Instrumentation::enable();
+      const int n = 1000;
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+      for ( int i = 0; i < n; ++i )
+        {
+          DGTAL_INSTRUMENT_SCOPE( "loop" );
+          DGTAL_INSTRUMENT_COUNT( "loop/iterations", 1 );
+          DGTAL_INSTRUMENT_COUNT( "loop/sum", i );
+        }
+      Instrumentation::disable();
+      const Instrumentation::Counters counters = Instrumentation::counters();
+      REQUIRE( counters.find( "loop/iterations" )->second == n );
+      REQUIRE( counters.find( "loop/sum" )->second == n * ( n - 1 ) / 2 );
+      REQUIRE( Instrumentation::timers().find( "loop" )->second.nbCalls == (std::size_t) n );
+      // Events are not recorded.
+      REQUIRE( Instrumentation::events().empty() );
+    }
+
+  SECTION( "Instrumentation points of DGtal algorithms" )
+    {
+      typedef ExactPredicateLpSeparableMetric<Z2i::Space, 2> L2Metric;
+      typedef VoronoiMap<Z2i::Space, Z2i::DigitalSet, L2Metric> Voronoi;
+      Z2i::Domain domain( Z2i::Point( 0, 0 ), Z2i::Point( 15, 15 ) );
+      Z2i::DigitalSet set( domain );
+      set.insertNew( Z2i::Point( 3, 4 ) );
+      set.insertNew( Z2i::Point( 11, 9 ) );
+      L2Metric l2;
+      Instrumentation::enable();
+      Voronoi voronoi( domain, set, l2 );
+      Instrumentation::disable();
+      const Instrumentation::Timers timers = Instrumentation::timers();
+      REQUIRE( timers.count( "VoronoiMap::compute" ) == 1 );
+      REQUIRE( timers.count( "VoronoiMap::compute/VoronoiMap::init" ) == 1 );
+      REQUIRE( timers.find( "VoronoiMap::compute/VoronoiMap::computeOtherSteps" )->second.nbCalls == 2 );
+      REQUIRE( Instrumentation::counters().find( "VoronoiMap::compute/nb points" )->second == 256 );
+    }
+
+  SECTION( "Data of exited threads are kept and their storage is reused" )
+    {
+      Instrumentation::enable( true );
+      {
+        DGTAL_INSTRUMENT_SCOPE( "main thread" );
+      }
+      for ( unsigned int i = 0; i < 50; ++i )
+        {
+          std::thread worker( [] () {
+              DGTAL_INSTRUMENT_SCOPE( "worker" );
+              DGTAL_INSTRUMENT_COUNT( "worker counter", 2 );
+            } );
+          worker.join();
+        }
+      Instrumentation::disable();
+      REQUIRE( Instrumentation::timers().find( "worker" )->second.nbCalls == 50 );
+      REQUIRE( Instrumentation::counters().find( "worker counter" )->second == 100 );
+      const Instrumentation::Events events = Instrumentation::events();
+      unsigned int maxThread = 0;
+      for ( auto e : events ) maxThread = std::max( maxThread, e.thread );
+      REQUIRE( events.size() == 51 );
+      // Threads run one after the other, so that they use the same storage.
+      REQUIRE( maxThread <= 1 );
+    }
+
+  SECTION( "Reports and exports" )
+    {
+      Instrumentation::enable( true );
+      {
+        DGTAL_INSTRUMENT_SCOPE( "export" );
+        DGTAL_INSTRUMENT_COUNT( "export \"quoted\"", 42 );
+        work( 1000 );
+      }
+      Instrumentation::disable();
+      std::ostringstream report, json, chrome;
+      Instrumentation::report( report );
+      Instrumentation::exportJSON( json );
+      Instrumentation::exportChromeTrace( chrome );
+      trace.info() << report.str();
+      REQUIRE( report.str().find( "export" ) != std::string::npos );
+      REQUIRE( json.str().find( "{\"name\":\"export\",\"calls\":1," ) != std::string::npos );
+      REQUIRE( json.str().find( "{\"name\":\"export \\\"quoted\\\"\",\"value\":42}" ) != std::string::npos );
+      REQUIRE( chrome.str().find( "\"traceEvents\":[" ) != std::string::npos );
+      REQUIRE( chrome.str().find( "{\"name\":\"export\",\"cat\":\"DGtal\",\"ph\":\"X\"" ) != std::string::npos );
+      REQUIRE( chrome.str().find( "\"ph\":\"C\"" ) != std::string::npos );
+    }
+
+  Instrumentation::disable();
+  Instrumentation::reset();
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,120 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPackedFreemanChain.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class PackedFreemanChain.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/PackedFreemanChain.h"
+#include "DGtal/geometry/curves/GridCurve.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PackedFreemanChain.
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "PackedFreemanChain unit tests", "[freeman_chain][packed]" )
+{
+  typedef FreemanChain<int>       Chain;
+  typedef PackedFreemanChain<int> PackedChain;
+  typedef PackedChain::Point      Point;
+
+  GIVEN( "A small closed contour" ) {
+    Chain fc( "00001111222233", 2, -1 );
+    PackedChain pc( fc );
+    std::vector< Point > expected;
+    Chain::getContourPoints( fc, expected );
+    std::vector< Point > pts;
+    pc.getPoints( pts );
+    THEN( "It has the points and codes of its Freeman chain" ) {
+      REQUIRE( pc.isValid() );
+      REQUIRE( pc.size() == fc.size() );
+      REQUIRE( pc.firstPoint() == Point( 2, -1 ) );
+      REQUIRE( pc.point( 6 ) == Point( 6, 1 ) );
+      REQUIRE( pts.size() == pc.size() + 1 );
+      REQUIRE( std::equal( expected.begin(), expected.end(), pts.begin() ) );
+      REQUIRE( pc.unpack().chain == fc.chain );
+      REQUIRE( ! pc.isClosed() );
+    }
+    THEN( "It is written and read like a Freeman chain" ) {
+      std::stringstream ss1, ss2;
+      Chain::write( ss1, fc );
+      PackedChain::write( ss2, pc );
+      REQUIRE( ss1.str() == ss2.str() );
+      std::stringstream ss3( "# a comment\n" + ss1.str() );
+      PackedChain pc2;
+      PackedChain::read( ss3, pc2 );
+      REQUIRE( pc2 == pc );
+    }
+  }
+
+  GIVEN( "A long random walk" ) {
+    srand( 0 );
+    std::string s;
+    for ( int i = 0; i < 10000; ++i )
+      s += static_cast<char>( '0' + ( rand() % 4 ) );
+    Chain fc( s, -5, 7 );
+    PackedChain pc( s, -5, 7 );
+    std::vector< Point > expected;
+    Chain::getContourPoints( fc, expected );
+    THEN( "Random access gives the points of the Freeman chain" ) {
+      REQUIRE( pc.isValid() );
+      REQUIRE( pc.lastPoint() == expected.back() );
+      bool ok = true;
+      for ( std::size_t i = 0; i <= pc.size(); ++i )
+        ok = ok && ( pc.point( i ) == expected[ i ] );
+      REQUIRE( ok );
+    }
+    THEN( "Points are visited in order, without being stored" ) {
+      std::vector< Point > pts;
+      pc.forEachPoint( [&pts] ( const Point& p ) { pts.push_back( p ); } );
+      REQUIRE( pts == expected );
+      std::vector< Point > it_pts( pc.begin(), pc.end() );
+      REQUIRE( it_pts == expected );
+    }
+    THEN( "It takes four times less memory than its Freeman chain" ) {
+      REQUIRE( pc.memoryUsage() * 3 < s.size() );
+    }
+  }
+
+  GIVEN( "A closed packed contour" ) {
+    PackedChain pc( "0123", 0, 0 );
+    GridCurve< KhalimskySpaceND< 2, int > > c;
+    c.initFromPointsRange( pc.begin(), pc.end() );
+    THEN( "A grid curve can be built from its points" ) {
+      REQUIRE( pc.isClosed() );
+      REQUIRE( c.size() == 4 );
+      REQUIRE( c.isClosed() );
+    }
+  }
+}
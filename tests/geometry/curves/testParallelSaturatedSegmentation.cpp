@@ -0,0 +1,146 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testParallelSaturatedSegmentation.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class ParallelSaturatedSegmentation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Circulator.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/geometry/curves/SaturatedSegmentation.h"
+#include "DGtal/geometry/curves/ParallelSaturatedSegmentation.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ParallelSaturatedSegmentation.
+///////////////////////////////////////////////////////////////////////////////
+
+/// A 4-connected curve made of digital straight pieces of random
+/// slopes, turning counterclockwise.
+std::vector< Z2i::Point > makeCurve( int nb_pieces )
+{
+  const Z2i::Point steps[ 4 ] = { Z2i::Point( 1, 0 ), Z2i::Point( 0, 1 ),
+                                  Z2i::Point( -1, 0 ), Z2i::Point( 0, -1 ) };
+  std::vector< Z2i::Point > curve;
+  Z2i::Point p( 0, 0 );
+  curve.push_back( p );
+  srand( 1 );
+  for ( int k = 0; k < nb_pieces; ++k )
+    {
+      const int a = 1 + rand() % 7;
+      const int b = a + 1 + rand() % 11;
+      const int length = 20 + rand() % 150;
+      for ( int i = 0; i < length; ++i )
+        {
+          const bool up = ( ( i + 1 ) * a / b ) > ( i * a / b );
+          p += steps[ ( k / 3 + ( up ? 1 : 0 ) ) % 4 ];
+          curve.push_back( p );
+        }
+    }
+  return curve;
+}
+
+/// Checks that both segmentations visit the same maximal segments.
+template < typename Segmentation, typename ParallelSegmentation >
+bool sameSegmentations( const Segmentation& S, const ParallelSegmentation& P )
+{
+  auto it  = S.begin();
+  auto itE = S.end();
+  auto pit = P.begin();
+  auto pitE = P.end();
+  unsigned int nb = 0;
+  for ( ; ( it != itE ) && ( pit != pitE ); ++it, ++pit, ++nb )
+    {
+      if ( ( it.begin() != pit.begin() ) || ( it.end() != pit.end() ) ) return false;
+      if ( it.intersectNext()     != pit.intersectNext() )     return false;
+      if ( it.intersectPrevious() != pit.intersectPrevious() ) return false;
+    }
+  return ( it == itE ) && ( pit == pitE ) && ( nb == P.size() ) && ( nb > 0 );
+}
+
+SCENARIO( "ParallelSaturatedSegmentation unit tests", "[segmentation][parallel]" )
+{
+  typedef std::vector< Z2i::Point >::const_iterator  ConstIterator;
+  typedef Circulator< ConstIterator >                ConstCirculator;
+  typedef ArithmeticalDSSComputer< ConstIterator, int, 4 >   DSSComputer;
+  typedef ArithmeticalDSSComputer< ConstCirculator, int, 4 > CircularDSSComputer;
+  const std::vector< std::string > modes =
+    { "First", "MostCentered", "Last", "First++", "MostCentered++", "Last++" };
+  const std::vector< Z2i::Point > curve = makeCurve( 120 );
+
+  GIVEN( "An open curve" ) {
+    THEN( "Maximal segments of chunks are the ones of the whole curve, in every mode" ) {
+      REQUIRE( curve.size() > 5000 );
+      for ( const auto& mode : modes )
+        {
+          SaturatedSegmentation< DSSComputer > S( curve.begin(), curve.end(), DSSComputer() );
+          ParallelSaturatedSegmentation< DSSComputer > P( curve.begin(), curve.end(), DSSComputer() );
+          S.setMode( mode );
+          P.setMode( mode );
+          P.setChunkSize( 64 );
+          INFO( "mode " << mode );
+          REQUIRE( sameSegmentations( S, P ) );
+        }
+    }
+    THEN( "Subranges are processed like SaturatedSegmentation" ) {
+      for ( const auto& mode : modes )
+        {
+          SaturatedSegmentation< DSSComputer > S( curve.begin(), curve.end(), DSSComputer() );
+          ParallelSaturatedSegmentation< DSSComputer > P( curve.begin(), curve.end(), DSSComputer() );
+          S.setSubRange( curve.begin() + 1000, curve.begin() + 4000 );
+          P.setSubRange( curve.begin() + 1000, curve.begin() + 4000 );
+          S.setMode( mode );
+          P.setMode( mode );
+          P.setChunkSize( 50 );
+          INFO( "mode " << mode );
+          REQUIRE( sameSegmentations( S, P ) );
+        }
+    }
+  }
+
+  GIVEN( "A closed curve" ) {
+    ConstCirculator c( curve.begin(), curve.begin(), curve.end() );
+    THEN( "Maximal segments of chunks are the ones of the whole curve, in every mode" ) {
+      for ( const auto& mode : modes )
+        {
+          SaturatedSegmentation< CircularDSSComputer > S( c, c, CircularDSSComputer() );
+          ParallelSaturatedSegmentation< CircularDSSComputer > P( c, c, CircularDSSComputer() );
+          S.setMode( mode );
+          P.setMode( mode );
+          P.setChunkSize( 100 );
+          INFO( "mode " << mode );
+          REQUIRE( sameSegmentations( S, P ) );
+        }
+    }
+  }
+}
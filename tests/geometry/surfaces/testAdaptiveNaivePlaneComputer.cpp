@@ -0,0 +1,295 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testAdaptiveNaivePlaneComputer.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing classes COBAAdaptiveNaivePlaneComputer and
+ * ChordAdaptiveNaivePlaneComputer.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/geometry/surfaces/CAdditivePrimitiveComputer.h"
+#include "DGtal/geometry/surfaces/COBAAdaptiveNaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/ChordAdaptiveNaivePlaneComputer.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing classes COBAAdaptiveNaivePlaneComputer and
+// ChordAdaptiveNaivePlaneComputer.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef Z3i::Space                                       Space;
+typedef Z3i::Point                                       Point;
+
+/// Returns \a nb points of the naive plane d <= ax+by+cz < d+c,
+/// with c > |a|, c > |b|, and |x|,|y| < R, plus some outliers.
+static std::vector<Point>
+makeNaivePlanePoints( DGtal::int64_t a, DGtal::int64_t b, DGtal::int64_t c,
+                      DGtal::int64_t d, DGtal::int64_t R, unsigned int nb )
+{
+  IntegerComputer<DGtal::int64_t> ic;
+  std::vector<Point> points;
+  for ( unsigned int i = 0; i < nb; ++i )
+    {
+      DGtal::int64_t x = ( (DGtal::int64_t) rand() % ( 2*R-1 ) ) - R + 1;
+      DGtal::int64_t y = ( (DGtal::int64_t) rand() % ( 2*R-1 ) ) - R + 1;
+      DGtal::int64_t z = ic.ceilDiv( d - a * x - b * y, c );
+      // one point in ten is pushed away from the plane.
+      if ( i % 10 == 9 ) z += 2 + rand() % 3;
+      points.push_back( Point( (Point::Coordinate) x, (Point::Coordinate) y,
+                               (Point::Coordinate) z ) );
+    }
+  return points;
+}
+
+SCENARIO( "COBAAdaptiveNaivePlaneComputer chooses its internal integers", "[coba][adaptive]" )
+{
+  typedef COBAAdaptiveNaivePlaneComputer<Space>        AdaptivePlane;
+  typedef COBANaivePlaneComputer<Space,DGtal::int64_t> Int64Plane;
+  typedef COBANaivePlaneComputer<Space,BigInteger>     BigPlane;
+  BOOST_CONCEPT_ASSERT(( concepts::CAdditivePrimitiveComputer< AdaptivePlane > ));
+  BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate< AdaptivePlane > ));
+  srand( 0 );
+
+  GIVEN( "Small and big diameters" ) {
+    THEN( "The bound check selects the expected integer type" ) {
+      REQUIRE(   AdaptivePlane::fitsSmallInteger( 20 ) );
+      REQUIRE(   AdaptivePlane::fitsSmallInteger( 400 ) );
+      REQUIRE( ! AdaptivePlane::fitsSmallInteger( 5000 ) );
+      REQUIRE( ! AdaptivePlane::fitsSmallInteger( 400, 1000, 1 ) );
+      REQUIRE( ! AdaptivePlane::fitsMediumInteger( 5000000 ) );
+      // Exact bounds of the class documentation.
+      REQUIRE(   AdaptivePlane::fitsSmallInteger( 724 ) );
+      REQUIRE( ! AdaptivePlane::fitsSmallInteger( 725 ) );
+      REQUIRE(   AdaptivePlane::fitsSmallInteger( 574, 2, 1 ) );
+      REQUIRE( ! AdaptivePlane::fitsSmallInteger( 575, 2, 1 ) );
+#ifdef WITH_INT128
+      REQUIRE(   AdaptivePlane::fitsMediumInteger( 5000 ) );
+      REQUIRE(   AdaptivePlane::fitsMediumInteger( 1176986 ) );
+      REQUIRE( ! AdaptivePlane::fitsMediumInteger( 1176987 ) );
+#endif
+    }
+  }
+  GIVEN( "Points of a naive plane of diameter 100" ) {
+    std::vector<Point> points = makeNaivePlanePoints( 3, -5, 11, 7, 50, 200 );
+    AdaptivePlane plane;
+    Int64Plane    ref;
+    plane.init( 2, 100, 1, 1 );
+    ref.init( 2, 100, 1, 1 );
+    REQUIRE( plane.integerLevel() == AdaptivePlane::SMALL_INTEGER );
+    unsigned int nb_diff = 0;
+    for ( auto p : points )
+      {
+        if ( plane.isExtendable( p ) != ref.isExtendable( p ) ) nb_diff++;
+        if ( plane.extend( p ) != ref.extend( p ) ) nb_diff++;
+      }
+    THEN( "It behaves exactly as the int64_t COBA computer" ) {
+      REQUIRE( nb_diff == 0 );
+      REQUIRE( plane.size() == ref.size() );
+      REQUIRE( plane.size() >= 150 );
+      REQUIRE( plane.primitive().normal() == ref.primitive().normal() );
+    }
+  }
+  GIVEN( "Points of a naive plane of diameter 5000" ) {
+    std::vector<Point> points = makeNaivePlanePoints( 123, -457, 1001, 17, 2500, 200 );
+    AdaptivePlane plane;
+    BigPlane      ref;
+    plane.init( 2, 5000, 1, 1 );
+    ref.init( 2, 5000, 1, 1 );
+#ifdef WITH_INT128
+    REQUIRE( plane.integerLevel() == AdaptivePlane::MEDIUM_INTEGER );
+#else
+    REQUIRE( plane.isLarge() );
+#endif
+    unsigned int nb_diff = 0;
+    for ( auto p : points )
+      if ( plane.extend( p ) != ref.extend( p ) ) nb_diff++;
+    THEN( "It behaves exactly as the BigInteger COBA computer" ) {
+      REQUIRE( nb_diff == 0 );
+      REQUIRE( plane.size() == ref.size() );
+      REQUIRE( plane.primitive().normal() == ref.primitive().normal() );
+    }
+  }
+  GIVEN( "Points of a naive plane of diameter 5000000" ) {
+    std::vector<Point> points = makeNaivePlanePoints( 12345, -45703, 100001, 17, 2500000, 50 );
+    AdaptivePlane plane;
+    BigPlane      ref;
+    plane.init( 2, 5000000, 1, 1 );
+    ref.init( 2, 5000000, 1, 1 );
+    REQUIRE( plane.isLarge() );
+    unsigned int nb_diff = 0;
+    for ( auto p : points )
+      if ( plane.extend( p ) != ref.extend( p ) ) nb_diff++;
+    THEN( "It behaves exactly as the BigInteger COBA computer" ) {
+      REQUIRE( nb_diff == 0 );
+      REQUIRE( plane.size() == ref.size() );
+    }
+  }
+}
+
+SCENARIO( "ChordAdaptiveNaivePlaneComputer switches to big integers when needed", "[chord][adaptive]" )
+{
+  typedef ChordAdaptiveNaivePlaneComputer<Space>                  AdaptivePlane;
+  typedef ChordNaivePlaneComputer<Space,Point,DGtal::int64_t>     Int64Plane;
+  typedef ChordNaivePlaneComputer<Space,Point,BigInteger>         BigPlane;
+  BOOST_CONCEPT_ASSERT(( concepts::CAdditivePrimitiveComputer< AdaptivePlane > ));
+  BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate< AdaptivePlane > ));
+  srand( 0 );
+
+  GIVEN( "Points of a naive plane with small coordinates" ) {
+    std::vector<Point> points = makeNaivePlanePoints( 3, -5, 11, 7, 1000, 200 );
+    AdaptivePlane plane;
+    Int64Plane    ref;
+    plane.init( 2, 1, 1 );
+    ref.init( 2, 1, 1 );
+    unsigned int nb_diff = 0;
+    for ( auto p : points )
+      {
+        if ( plane.isExtendable( p ) != ref.isExtendable( p ) ) nb_diff++;
+        if ( plane.extend( p ) != ref.extend( p ) ) nb_diff++;
+      }
+    THEN( "It behaves exactly as the int64_t chord computer" ) {
+      REQUIRE( plane.integerLevel() == AdaptivePlane::SMALL_INTEGER );
+      REQUIRE( nb_diff == 0 );
+      REQUIRE( plane.size() == ref.size() );
+      REQUIRE( plane.primitive().normal() == ref.primitive().normal() );
+    }
+  }
+  GIVEN( "Points of a naive plane with some huge coordinates" ) {
+    std::vector<Point> small_points = makeNaivePlanePoints( 3, -5, 11, 7, 1000, 50 );
+    std::vector<Point> big_points   = makeNaivePlanePoints( 3, -5, 11, 7, 500000000, 50 );
+    AdaptivePlane plane;
+    BigPlane      ref;
+    plane.init( 2, 1, 1 );
+    ref.init( 2, 1, 1 );
+    unsigned int nb_diff = 0;
+    for ( auto p : small_points )
+      if ( plane.extend( p ) != ref.extend( p ) ) nb_diff++;
+    bool small_before = ! plane.isLarge();
+    for ( auto p : big_points )
+      if ( plane.extend( p ) != ref.extend( p ) ) nb_diff++;
+    THEN( "It switches to wider integers and gives the same results" ) {
+      REQUIRE( small_before );
+#ifdef WITH_INT128
+      REQUIRE( plane.integerLevel() == AdaptivePlane::MEDIUM_INTEGER );
+#else
+      REQUIRE( plane.isLarge() );
+#endif
+      REQUIRE( nb_diff == 0 );
+      REQUIRE( plane.size() == ref.size() );
+      REQUIRE( std::equal( plane.begin(), plane.end(), ref.begin() ) );
+    }
+  }
+  GIVEN( "Queries with points of huge coordinates" ) {
+    std::vector<Point> small_points = makeNaivePlanePoints( 3, -5, 11, 7, 1000, 50 );
+    std::vector<Point> big_points   = makeNaivePlanePoints( 3, -5, 11, 7, 500000000, 20 );
+    AdaptivePlane plane;
+    BigPlane      ref;
+    plane.init( 2, 1, 1 );
+    ref.init( 2, 1, 1 );
+    for ( auto p : small_points ) { plane.extend( p ); ref.extend( p ); }
+    const AdaptivePlane & cplane = plane;
+    unsigned int nb_diff = 0;
+    for ( auto p : big_points )
+      {
+        if ( cplane.isExtendable( p ) != ref.isExtendable( p ) ) nb_diff++;
+        if ( cplane( p ) != ref( p ) ) nb_diff++;
+        Point q = p;
+        q[ 2 ] += 1000;
+        if ( cplane.isExtendable( q ) != ref.isExtendable( q ) ) nb_diff++;
+      }
+    const bool range_ok = cplane.isExtendable( big_points.begin(), big_points.end() )
+      == ref.isExtendable( big_points.begin(), big_points.end() );
+    // Queries interleaved with extensions must see the new points.
+    std::vector<Point> more_points = makeNaivePlanePoints( 3, -5, 11, 7, 2000, 20 );
+    for ( unsigned int i = 0; i < more_points.size(); ++i )
+      {
+        if ( plane.extend( more_points[ i ] ) != ref.extend( more_points[ i ] ) ) nb_diff++;
+        const Point & p = big_points[ i % big_points.size() ];
+        if ( cplane.isExtendable( p ) != ref.isExtendable( p ) ) nb_diff++;
+        if ( cplane( p ) != ref( p ) ) nb_diff++;
+      }
+    THEN( "They are answered with wider integers but do not change the computer" ) {
+      REQUIRE( nb_diff == 0 );
+      REQUIRE( range_ok );
+      REQUIRE( plane.integerLevel() == AdaptivePlane::SMALL_INTEGER );
+      REQUIRE( plane.size() == ref.size() );
+      REQUIRE( std::equal( plane.begin(), plane.end(), ref.begin() ) );
+    }
+  }
+  GIVEN( "Huge points that do not extend the plane" ) {
+    std::vector<Point> small_points = makeNaivePlanePoints( 3, -5, 11, 7, 1000, 50 );
+    std::vector<Point> big_points   = makeNaivePlanePoints( 3, -5, 11, 7, 500000000, 20 );
+    AdaptivePlane plane;
+    BigPlane      ref;
+    plane.init( 2, 1, 1 );
+    ref.init( 2, 1, 1 );
+    for ( auto p : small_points ) { plane.extend( p ); ref.extend( p ); }
+    unsigned int nb_diff = 0;
+    unsigned int nb_rejected = 0;
+    for ( auto p : big_points )
+      {
+        Point q = p;
+        q[ 2 ] += 100000000;
+        const bool ok = ref.isExtendable( q );
+        if ( ok ) continue;
+        nb_rejected++;
+        if ( plane.extend( q ) ) nb_diff++;
+        if ( plane.extendAsIs( q ) ) nb_diff++;
+      }
+    THEN( "The failed extensions keep the current integers and points" ) {
+      REQUIRE( nb_rejected > 0 );
+      REQUIRE( nb_diff == 0 );
+      REQUIRE( plane.integerLevel() == AdaptivePlane::SMALL_INTEGER );
+      REQUIRE( plane.size() == ref.size() );
+      REQUIRE( std::equal( plane.begin(), plane.end(), ref.begin() ) );
+    }
+  }
+  GIVEN( "A range of points given at once" ) {
+    std::vector<Point> points = makeNaivePlanePoints( 2, 7, 13, 1, 100000, 100 );
+    std::vector<Point> inliers;
+    for ( unsigned int i = 0; i < points.size(); ++i )
+      if ( i % 10 != 9 ) inliers.push_back( points[ i ] );
+    AdaptivePlane plane;
+    plane.init( 2, 1, 1 );
+    THEN( "The batched extension accepts the inliers and rejects the outliers" ) {
+      REQUIRE( plane.extend( inliers.begin(), inliers.end() ) );
+      REQUIRE( ! plane.isExtendable( points.begin(), points.end() ) );
+      REQUIRE( ! plane.extend( points.begin(), points.end() ) );
+      REQUIRE( plane.size() <= inliers.size() );
+    }
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,100 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMultiScaleVoronoiCovarianceMeasureOnSurface.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class MultiScaleVoronoiCovarianceMeasureOnDigitalSurface.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/surfaces/estimation/VoronoiCovarianceMeasureOnDigitalSurface.h"
+#include "DGtal/geometry/surfaces/estimation/MultiScaleVoronoiCovarianceMeasureOnDigitalSurface.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class MultiScaleVoronoiCovarianceMeasureOnDigitalSurface.
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "MultiScaleVoronoiCovarianceMeasureOnDigitalSurface matches single scale VCM", "[vcm][multiscale]" )
+{
+  typedef Shortcuts< Z3i::KSpace >                        SH3;
+  typedef SH3::LightDigitalSurface                        LightDigitalSurface;
+  typedef LightDigitalSurface::DigitalSurfaceContainer    SurfaceContainer;
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space,2>   Metric;
+  typedef functors::HatPointFunction<Z3i::Point,double>   KernelFunction;
+  typedef VoronoiCovarianceMeasureOnDigitalSurface<SurfaceContainer,Metric,KernelFunction> VCMOnSurface;
+  typedef MultiScaleVoronoiCovarianceMeasureOnDigitalSurface<SurfaceContainer,Metric,KernelFunction> MSVCMOnSurface;
+
+  auto params = SH3::defaultParameters();
+  params( "polynomial", "goursat" )( "gridstep", 0.5 );
+  auto implicit_shape  = SH3::makeImplicitShape3D  ( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto binary_image    = SH3::makeBinaryImage( digitized_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto surface         = SH3::makeLightDigitalSurface( binary_image, K, params );
+
+  std::vector<double> Rs = { 6.0, 3.0 };
+  std::vector<double> rs = { 3.0, 2.0 };
+  std::vector<KernelFunction> chis = { KernelFunction( 1.0, rs[ 0 ] ),
+                                       KernelFunction( 1.0, rs[ 1 ] ) };
+  MSVCMOnSurface ms_vcm( *surface, Pointels, Rs, rs, chis, 2.5, Metric() );
+  const auto& surfels = ms_vcm.surfels();
+  REQUIRE( surface->size() > 0 );
+  REQUIRE( surfels.size() == surface->size() );
+  REQUIRE( ms_vcm.nbScales() == 2 );
+
+  for ( std::size_t k = 0; k < Rs.size(); ++k )
+    {
+      VCMOnSurface vcm( *surface, Pointels, Rs[ k ], rs[ k ], chis[ k ], 2.5, Metric() );
+      unsigned int nb_diff_normals = 0;
+      unsigned int nb_diff_values  = 0;
+      for ( std::size_t i = 0; i < surfels.size(); ++i )
+        {
+          const auto& normals = vcm.mapSurfel2Normals().find( surfels[ i ] )->second;
+          if ( ( normals.vcmNormal - ms_vcm.vcmNormals( k )[ i ] ).norm() > 1e-8 )
+            nb_diff_normals += 1;
+          if ( ( normals.trivialNormal - ms_vcm.trivialNormals()[ i ] ).norm() > 1e-8 )
+            nb_diff_normals += 1;
+          MSVCMOnSurface::VectorN v1, v2;
+          vcm.getChiVCMEigenvalues( v1, surfels[ i ] );
+          ms_vcm.getChiVCMEigenvalues( k, v2, surfels[ i ] );
+          if ( ( v1 - v2 ).norm() > 1e-8 * ( 1.0 + v1.norm() ) ) nb_diff_values += 1;
+        }
+      THEN( "VCM normals and eigenvalues are the same as the single scale ones" ) {
+        REQUIRE( nb_diff_normals == 0 );
+        REQUIRE( nb_diff_values  == 0 );
+      }
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,113 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPlaneProbingDigitalSurfaceLocalEstimator.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class PlaneProbingDigitalSurfaceLocalEstimator.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/geometry/surfaces/DigitalSurfacePredicate.h"
+#include "DGtal/geometry/surfaces/estimation/PlaneProbingTetrahedronEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/PlaneProbingParallelepipedEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/PlaneProbingDigitalSurfaceLocalEstimator.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Shortcuts< Z3i::KSpace >          SH3;
+typedef SH3::DigitalSurface               Surface;
+typedef DigitalSurfacePredicate<Surface>  SurfacePredicate;
+
+/**
+ * Compares the batched evaluation with the surfel by surfel evaluation.
+ */
+template < typename Estimator >
+unsigned int nbDifferences( CountedPtr<Surface> surface,
+                            typename Estimator::ProbingFactory const& factory )
+{
+  auto surfels = SH3::getSurfelRange( surface );
+  Estimator estimator_one( surface, factory );
+  estimator_one.init( 1.0, surfels.begin(), surfels.end() );
+  std::vector< typename Estimator::Quantity > normals_one;
+  for ( auto it = surfels.begin(); it != surfels.end(); ++it )
+    normals_one.push_back( estimator_one.eval( it ) );
+
+  Estimator estimator_batch( surface, factory );
+  estimator_batch.init( 1.0, surfels.begin(), surfels.end() );
+  std::vector< typename Estimator::Quantity > normals_batch;
+  estimator_batch.eval( surfels.begin(), surfels.end(), std::back_inserter( normals_batch ) );
+
+  unsigned int nb_diff = ( normals_one.size() == normals_batch.size() ) ? 0 : 1;
+  for ( std::size_t i = 0; i < std::min( normals_one.size(), normals_batch.size() ); ++i )
+    if ( normals_one[ i ] != normals_batch[ i ] ) nb_diff += 1;
+  return nb_diff;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PlaneProbingDigitalSurfaceLocalEstimator.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Batched PlaneProbingDigitalSurfaceLocalEstimator" )
+{
+  auto params          = SH3::defaultParameters();
+  params( "polynomial", "goursat" )( "gridstep", 1.0 );
+  auto implicit_shape  = SH3::makeImplicitShape3D  ( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto binary_image    = SH3::makeBinaryImage( digitized_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto surface         = SH3::makeDigitalSurface( binary_image, K, params );
+  REQUIRE( surface->size() > 0 );
+
+  SECTION( "Tetrahedron estimator with H-neighborhood" )
+    {
+      using ProbingAlgorithm = PlaneProbingTetrahedronEstimator<SurfacePredicate, ProbingMode::H>;
+      using Estimator        = PlaneProbingDigitalSurfaceLocalEstimator<Surface, ProbingAlgorithm>;
+      Estimator::ProbingFactory factory =
+        [] ( const Estimator::ProbingFrame& frame, const SurfacePredicate& predicate ) {
+        return new ProbingAlgorithm( frame.p, { frame.b1, frame.b2, frame.normal }, predicate );
+      };
+      REQUIRE( nbDifferences< Estimator >( surface, factory ) == 0 );
+    }
+
+  SECTION( "Parallelepiped estimator with R1-neighborhood" )
+    {
+      using ProbingAlgorithm = PlaneProbingParallelepipedEstimator<SurfacePredicate, ProbingMode::R1>;
+      using Estimator        = PlaneProbingDigitalSurfaceLocalEstimator<Surface, ProbingAlgorithm>;
+      const int bound = 100;
+      Estimator::ProbingFactory factory =
+        [bound] ( const Estimator::ProbingFrame& frame, const SurfacePredicate& predicate ) {
+        return new ProbingAlgorithm( frame.p, { frame.b1, frame.b2, frame.normal }, predicate, bound );
+      };
+      REQUIRE( nbDifferences< Estimator >( surface, factory ) == 0 );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,175 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSliceContourExtractor.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class SliceContourExtractor.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/curves/GridCurve.h"
+#include "DGtal/geometry/helpers/SliceContourExtractor.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef SliceContourExtractor< Z3i::KSpace > Extractor;
+typedef Extractor::Contour                   Contour;
+typedef Extractor::SliceContours             SliceContours;
+
+/// Twice the signed area enclosed by a closed contour.
+static long doubleArea( const Contour& c )
+{
+  std::vector< Contour::Point > pts;
+  c.getPoints( pts );
+  long a = 0;
+  for ( std::size_t i = 0; i + 1 < pts.size(); ++i )
+    a += long( pts[ i ][ 0 ] ) * pts[ i+1 ][ 1 ] - long( pts[ i+1 ][ 0 ] ) * pts[ i ][ 1 ];
+  return a;
+}
+
+/// Number of pixels and of boundary linels of slice x orthogonal to k.
+static void sliceStats( const Z3i::DigitalSet& S,
+                        Dimension k, int x, long& nb_pixels, long& nb_linels )
+{
+  nb_pixels = nb_linels = 0;
+  for ( auto p : S )
+    {
+      if ( p[ k ] != x ) continue;
+      ++nb_pixels;
+      for ( Dimension d = 0; d < 3; ++d )
+        {
+          if ( d == k ) continue;
+          for ( int s = -1; s <= 1; s += 2 )
+            {
+              Z3i::Point q = p;
+              q[ d ] += s;
+              if ( ! S( q ) ) ++nb_linels;
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SliceContourExtractor.
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "SliceContourExtractor unit tests", "[slice_contours]" )
+{
+  Z3i::Domain domain( Z3i::Point( -10, -10, -10 ), Z3i::Point( 10, 10, 10 ) );
+  Z3i::KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+
+  GIVEN( "A thick spherical shell" ) {
+    Z3i::DigitalSet shell( domain );
+    for ( auto p : domain )
+      {
+        const auto n2 = p.squaredNorm();
+        if ( ( n2 >= 16 ) && ( n2 <= 64 ) ) shell.insertNew( p );
+      }
+    for ( Dimension k = 0; k < 3; ++k )
+      {
+        std::vector< SliceContours > contours;
+        Extractor::extractAllSliceContours( contours, K, k, shell );
+        REQUIRE( contours.size() == 21 );
+        THEN( "Contours are closed, ccw around the shape, and cover its boundary" ) {
+          for ( int x = -10; x <= 10; ++x )
+            {
+              long nb_pixels, nb_linels;
+              sliceStats( shell, k, x, nb_pixels, nb_linels );
+              const SliceContours& C = contours[ x + 10 ];
+              long area = 0, length = 0, nb_holes = 0;
+              for ( const auto& c : C )
+                {
+                  REQUIRE( c.isClosed() );
+                  const long a = doubleArea( c );
+                  area   += a;
+                  length += long( c.size() );
+                  nb_holes += a < 0 ? 1 : 0;
+                }
+              REQUIRE( area == 2 * nb_pixels );
+              REQUIRE( length == nb_linels );
+              const std::size_t expected = std::abs( x ) > 8 ? 0
+                : std::abs( x ) >= 4 ? 1 : 2;
+              REQUIRE( C.size() == expected );
+              REQUIRE( nb_holes == ( expected == 2 ? 1 : 0 ) );
+            }
+        }
+        THEN( "Each slice gives the same contours as when extracted alone" ) {
+          for ( int x = -10; x <= 10; ++x )
+            {
+              SliceContours C;
+              Extractor::extractSliceContours( C, K, k, x, shell );
+              REQUIRE( C == contours[ x + 10 ] );
+            }
+        }
+      }
+  }
+
+  GIVEN( "Two voxels touching by an edge" ) {
+    Z3i::DigitalSet S( domain );
+    S.insertNew( Z3i::Point( 0, 0, 0 ) );
+    S.insertNew( Z3i::Point( 1, 1, 0 ) );
+    SliceContours C4, C8;
+    Extractor::extractSliceContours( C4, K, 2, 0, S, true );
+    Extractor::extractSliceContours( C8, K, 2, 0, S, false );
+    THEN( "They form two 4-connected contours or one 8-connected contour" ) {
+      REQUIRE( C4.size() == 2 );
+      REQUIRE( C4[ 0 ] == Contour( "0123", 0, 0 ) );
+      REQUIRE( C4[ 1 ] == Contour( "0123", 1, 1 ) );
+      REQUIRE( C8.size() == 1 );
+      REQUIRE( C8[ 0 ] == Contour( "01012323", 0, 0 ) );
+    }
+  }
+
+  GIVEN( "A box sliced along axis 0" ) {
+    Z3i::DigitalSet S( domain );
+    for ( auto p : domain )
+      if ( ( p[ 1 ] >= 2 ) && ( p[ 1 ] <= 4 ) && ( p[ 2 ] >= -1 ) && ( p[ 2 ] <= 0 ) )
+        S.insertNew( p );
+    SliceContours C;
+    Extractor::extractSliceContours( C, K, 0, 3, S );
+    THEN( "Its slice is a rectangle in the (y,z) coordinates, usable as a GridCurve" ) {
+      REQUIRE( Extractor::uAxis( 0 ) == 1 );
+      REQUIRE( Extractor::vAxis( 0 ) == 2 );
+      REQUIRE( C.size() == 1 );
+      REQUIRE( C[ 0 ] == Contour( "0001122233", 2, -1 ) );
+      std::vector< Z2i::Point > pts;
+      C[ 0 ].getPoints( pts );
+      Z2i::KSpace K2;
+      K2.init( Z2i::Point( -10, -10 ), Z2i::Point( 10, 10 ), true );
+      GridCurve< Z2i::KSpace > gc( K2 );
+      gc.initFromPointsRange( pts.begin(), pts.end() );
+      REQUIRE( gc.isClosed() );
+      REQUIRE( gc.size() == 10 );
+    }
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
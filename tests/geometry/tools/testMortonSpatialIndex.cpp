@@ -0,0 +1,166 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMortonSpatialIndex.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class MortonSpatialIndex.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/tools/MortonSpatialIndex.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+/// Brute force radius query.
+template <typename Point>
+std::vector< std::size_t > bruteRadius( const std::vector< Point >& pts,
+                                        const Point& q, double r )
+{
+  std::vector< std::size_t > result;
+  for ( std::size_t i = 0; i < pts.size(); ++i )
+    {
+      double d2 = 0.0;
+      for ( Dimension k = 0; k < Point::dimension; ++k )
+        d2 += double( pts[ i ][ k ] - q[ k ] ) * double( pts[ i ][ k ] - q[ k ] );
+      if ( d2 <= r * r ) result.push_back( i );
+    }
+  return result;
+}
+
+/// Brute force k-nearest-neighbor query, ties broken by index.
+template <typename Point>
+std::vector< std::size_t > bruteKNearest( const std::vector< Point >& pts,
+                                          const Point& q, std::size_t k )
+{
+  std::vector< std::pair< double, std::size_t > > cands;
+  for ( std::size_t i = 0; i < pts.size(); ++i )
+    {
+      double d2 = 0.0;
+      for ( Dimension j = 0; j < Point::dimension; ++j )
+        d2 += double( pts[ i ][ j ] - q[ j ] ) * double( pts[ i ][ j ] - q[ j ] );
+      cands.push_back( std::make_pair( d2, i ) );
+    }
+  std::sort( cands.begin(), cands.end() );
+  std::vector< std::size_t > result;
+  for ( std::size_t i = 0; i < std::min( k, cands.size() ); ++i )
+    result.push_back( cands[ i ].second );
+  return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class MortonSpatialIndex.
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "MortonSpatialIndex Morton keys", "[spatial_index][morton]" )
+{
+  typedef MortonSpatialIndex< Z3i::RealPoint > Index3;
+  typedef MortonSpatialIndex< Z2i::Point >     Index2;
+  Index3::Cell c3 = {{ 5, 1234, 77777 }};
+  Index2::Cell c2 = {{ 123456789, 42 }};
+  THEN( "Decoding inverts encoding and keys interleave coordinate bits" ) {
+    REQUIRE( Index3::decode( Index3::encode( c3 ) ) == c3 );
+    REQUIRE( Index2::decode( Index2::encode( c2 ) ) == c2 );
+    Index3::Cell u = {{ 1, 0, 0 }}, v = {{ 0, 1, 0 }}, w = {{ 1, 1, 1 }};
+    REQUIRE( Index3::encode( u ) == 1 );
+    REQUIRE( Index3::encode( v ) == 2 );
+    REQUIRE( Index3::encode( w ) == 7 );
+  }
+}
+
+SCENARIO( "MortonSpatialIndex queries", "[spatial_index]" )
+{
+  std::mt19937 gen( 7 );
+  GIVEN( "Random real points in 3D" ) {
+    std::uniform_real_distribution< double > U( -10.0, 10.0 );
+    std::vector< Z3i::RealPoint > pts( 2000 );
+    for ( auto& p : pts ) p = Z3i::RealPoint( U( gen ), U( gen ), 0.5 * U( gen ) );
+    MortonSpatialIndex< Z3i::RealPoint > index( pts.begin(), pts.end() );
+    REQUIRE( index.isValid() );
+    REQUIRE( index.size() == pts.size() );
+    std::vector< Z3i::RealPoint > queries( 100 );
+    for ( auto& q : queries ) q = Z3i::RealPoint( 1.5 * U( gen ), 1.5 * U( gen ), U( gen ) );
+    queries.push_back( pts[ 0 ] );
+    THEN( "Radius queries match brute force" ) {
+      std::vector< std::vector< std::size_t > > results;
+      for ( double r : { 0.5, 2.0, 7.0 } )
+        {
+          index.radiusQueries( queries, r, results );
+          REQUIRE( results.size() == queries.size() );
+          for ( std::size_t i = 0; i < queries.size(); ++i )
+            REQUIRE( results[ i ] == bruteRadius( pts, queries[ i ], r ) );
+        }
+    }
+    THEN( "k-nearest-neighbor queries match brute force" ) {
+      std::vector< std::vector< std::size_t > > results;
+      for ( std::size_t k : { 1, 10, 100 } )
+        {
+          index.kNearestQueries( queries, k, results );
+          for ( std::size_t i = 0; i < queries.size(); ++i )
+            REQUIRE( results[ i ] == bruteKNearest( pts, queries[ i ], k ) );
+        }
+      REQUIRE( index.nearest( pts[ 0 ] ) == 0 );
+    }
+  }
+  GIVEN( "Digital points in 2D, with many ties and duplicates" ) {
+    std::uniform_int_distribution< int > U( -30, 30 );
+    std::vector< Z2i::Point > pts( 1500 );
+    for ( auto& p : pts ) p = Z2i::Point( U( gen ), U( gen ) / 3 );
+    for ( double cell_size : { 0.0, 1.0, 5.0 } )
+      {
+        MortonSpatialIndex< Z2i::Point > index( pts.begin(), pts.end(), cell_size );
+        std::vector< Z2i::Point > queries;
+        for ( int i = 0; i < 50; ++i ) queries.push_back( Z2i::Point( 2 * U( gen ), U( gen ) ) );
+        std::vector< std::vector< std::size_t > > results;
+        index.radiusQueries( queries, 3.0, results );
+        for ( std::size_t i = 0; i < queries.size(); ++i )
+          REQUIRE( results[ i ] == bruteRadius( pts, queries[ i ], 3.0 ) );
+        index.kNearestQueries( queries, 20, results );
+        for ( std::size_t i = 0; i < queries.size(); ++i )
+          REQUIRE( results[ i ] == bruteKNearest( pts, queries[ i ], 20 ) );
+      }
+  }
+  GIVEN( "An empty index and a tiny one" ) {
+    std::vector< Z2i::Point > pts = { Z2i::Point( 3, 3 ) };
+    MortonSpatialIndex< Z2i::Point > empty, tiny( pts.begin(), pts.end() );
+    std::vector< std::size_t > result;
+    empty.kNearestQuery( Z2i::Point( 0, 0 ), 3, result );
+    REQUIRE( result.empty() );
+    tiny.kNearestQuery( Z2i::Point( 0, 0 ), 3, result );
+    REQUIRE( result == std::vector< std::size_t >( 1, 0 ) );
+    tiny.radiusQuery( Z2i::Point( 0, 0 ), 4.0, result );
+    REQUIRE( result.size() == 0 );
+    tiny.radiusQuery( Z2i::Point( 0, 0 ), 5.0, result );
+    REQUIRE( result.size() == 1 );
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
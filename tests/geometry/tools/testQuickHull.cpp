@@ -185,7 +185,102 @@ SCENARIO( "QuickHull< ConvexHullIntegralKernel< 3 > > unit tests", "[quickhull][
       REQUIRE( hull.nbVertices() < hull.nbPoints() );
     }
   }
+  GIVEN( "Given 20000 random point in a ball of radius 100 " ) {
+    std::vector<Point> V = randomPointsInBall< Point >( 20000, 100 );
+    QHull hull;
+    hull.setInput( V, false );
+    hull.computeConvexHull();
+    QHull fast_hull;
+    fast_hull.parallel_threshold = 1;
+    fast_hull.setInput( V, false );
+    const auto nb_removed = fast_hull.filterInteriorPoints();
+    fast_hull.computeConvexHull();
+    THEN( "Filtering removes most points and the convex hull is valid" ) {
+      REQUIRE( nb_removed > V.size() / 3 );
+      REQUIRE( fast_hull.nbPoints() + nb_removed == V.size() );
+      REQUIRE( fast_hull.check() );
+    }
+    THEN( "Filtered parallel convex hull is the same as the sequential one" ) {
+      std::vector< Point > P, Q;
+      hull.getVertexPositions( P );
+      fast_hull.getVertexPositions( Q );
+      std::sort( P.begin(), P.end() );
+      std::sort( Q.begin(), Q.end() );
+      REQUIRE( hull.nbFacets() == fast_hull.nbFacets() );
+      REQUIRE( P == Q );
+    }
+    THEN( "Mappings between input and filtered points are consistent" ) {
+      std::size_t nb_ok = 0;
+      for ( std::size_t i = 0; i < fast_hull.comp2input.size(); i++ )
+        nb_ok += ( fast_hull.input2comp[ fast_hull.comp2input[ i ] ] == i
+                   && fast_hull.points[ i ] == V[ fast_hull.comp2input[ i ] ] )
+          ? 1 : 0;
+      REQUIRE( nb_ok == fast_hull.nbPoints() );
+    }
+    THEN( "Filtering twice keeps mappings consistent" ) {
+      QHull twice_hull;
+      twice_hull.setInput( V, false );
+      const auto nb_removed_1 = twice_hull.filterInteriorPoints();
+      const auto nb_removed_2 = twice_hull.filterInteriorPoints();
+      REQUIRE( nb_removed_1 == nb_removed );
+      REQUIRE( twice_hull.nbPoints() + nb_removed_1 + nb_removed_2 == V.size() );
+      REQUIRE( twice_hull.input2comp.size() == V.size() );
+      REQUIRE( twice_hull.comp2input.size() == twice_hull.nbPoints() );
+      std::size_t nb_assigned = 0;
+      for ( std::size_t i = 0; i < V.size(); i++ )
+        {
+          const auto c = twice_hull.input2comp[ i ];
+          if ( c == QHull::UNASSIGNED ) continue;
+          REQUIRE( c < twice_hull.nbPoints() );
+          REQUIRE( twice_hull.comp2input[ c ] == i );
+          nb_assigned++;
+        }
+      REQUIRE( nb_assigned == twice_hull.nbPoints() );
+      twice_hull.computeConvexHull();
+      REQUIRE( twice_hull.check() );
+      REQUIRE( twice_hull.nbFacets() == hull.nbFacets() );
+    }
+  }
+}
+
+
+#ifdef WITH_INT128
+SCENARIO( "QuickHull< ConvexHullIntegralKernel< 3, int64, int128 > > unit tests", "[quickhull][integral_kernel][3d][int128]" )
+{
+  typedef ConvexHullIntegralKernel< 3, DGtal::int64_t, DGtal::int128_t > QHKernel;
+  typedef QuickHull< QHKernel >            QHull;
+  typedef SpaceND< 3, DGtal::int64_t >     Space;
+  typedef Space::Point                     Point;
+
+  GIVEN( "Given 100 random point in a ball of radius 1000000 " ) {
+    std::vector<Point> V = randomPointsInBall< Point >( 100, 1000000 );
+    QHull hull;
+    hull.setInput( V, false );
+    hull.computeConvexHull();
+    THEN( "The convex hull is valid and contains every point" ) {
+      REQUIRE( hull.check() );
+    }
+    THEN( "Its convex hull has fewer vertices than input points" ) {
+      REQUIRE( hull.nbVertices() < hull.nbPoints() );
+    }
+#ifdef WITH_BIGINTEGER
+    THEN( "It is the same convex hull as with BigInteger" ) {
+      typedef ConvexHullIntegralKernel< 3, DGtal::int64_t, DGtal::BigInteger > QHBigKernel;
+      QuickHull< QHBigKernel > big_hull;
+      big_hull.setInput( V, false );
+      big_hull.computeConvexHull();
+      std::vector< Point > P, Q;
+      hull.getVertexPositions( P );
+      big_hull.getVertexPositions( Q );
+      std::sort( P.begin(), P.end() );
+      std::sort( Q.begin(), Q.end() );
+      REQUIRE( hull.nbFacets() == big_hull.nbFacets() );
+      REQUIRE( P == Q );
+    }
+#endif
+  }
 }
+#endif
 
 
 ///////////////////////////////////////////////////////////////////////////////
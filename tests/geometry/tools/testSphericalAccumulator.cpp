@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
+#include <cstdlib>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/geometry/tools/SphericalAccumulator.h"
@@ -199,6 +201,104 @@ bool testSphericalMoreIntegerDir()
   return nbok == nb;
 }
 
+bool testSphericalBatchAndMerge()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing Spherical Accumulator batch insertion and merge ..." );
+
+  typedef Z3i::Vector Vector;
+  typedef SphericalAccumulator<Vector>::Size Size;
+  std::vector<Vector> dirs;
+  srand( 3 );
+  while ( dirs.size() < 5000 )
+    {
+      const Vector v( rand() % 201 - 100, rand() % 201 - 100, rand() % 201 - 100 );
+      if ( v != Vector::zero ) dirs.push_back( v );
+    }
+  SphericalAccumulator<Vector> seq( 12 ), batch( 12 ), merged( 12 );
+  for ( const auto& v : dirs ) seq.addDirection( v );
+  batch.addDirections( dirs.begin(), dirs.end() );
+  //Two thread-local like accumulators
+  SphericalAccumulator<Vector> part1( merged ), part2( merged );
+  part1.addDirections( dirs.begin(), dirs.begin() + 1234 );
+  for ( auto it = dirs.begin() + 1234; it != dirs.end(); ++it ) part2.addDirection( *it );
+  merged.merge( part1 );
+  merged.merge( part2 );
+
+  bool same = true;
+  for ( Size i = 0; i < 12; ++i )
+    for ( Size j = 0; j < 24; ++j )
+      if ( seq.isValidBin( i, j ) )
+        same = same
+          && ( seq.count( i, j ) == batch.count( i, j ) )
+          && ( seq.count( i, j ) == merged.count( i, j ) )
+          && ( seq.representativeDirection( i, j ) == batch.representativeDirection( i, j ) )
+          && ( seq.representativeDirection( i, j ) == merged.representativeDirection( i, j ) );
+  nbok += same ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same bins as sequential insertion" << std::endl;
+  Size i1, j1, i2, j2, i3, j3;
+  seq.maxCountBin( i1, j1 );
+  batch.maxCountBin( i2, j2 );
+  merged.maxCountBin( i3, j3 );
+  nbok += ( ( batch.samples() == seq.samples() ) && ( merged.samples() == seq.samples() )
+            && ( batch.count( i2, j2 ) == seq.count( i1, j1 ) )
+            && ( merged.count( i3, j3 ) == seq.count( i1, j1 ) ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same samples and max count" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testSphericalDominantBins()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing Spherical Accumulator dominant bins ..." );
+
+  typedef Z3i::RealVector Vector;
+  typedef SphericalAccumulator<Vector>::Size Size;
+  const Vector axes[ 3 ] = { Vector( 0.6, 0.8, 0.0 ), Vector( 0.0, 0.0, 1.0 ), Vector( 0.0, 0.6, -0.8 ) };
+  const int sizes[ 3 ] = { 3000, 2000, 1000 };
+  std::vector<Vector> dirs;
+  srand( 5 );
+  for ( int k = 0; k < 3; ++k )
+    for ( int i = 0; i < sizes[ k ]; ++i )
+      {
+        const Vector noise( rand() % 1001 - 500, rand() % 1001 - 500, rand() % 1001 - 500 );
+        dirs.push_back( axes[ k ] + 0.0002 * noise );
+      }
+  SphericalAccumulator<Vector> accumulator( 40 );
+  accumulator.addDirections( dirs.begin(), dirs.end() );
+  std::vector< std::pair<Size,Size> > bins;
+  accumulator.dominantBins( 5, bins );
+  trace.info() << "Nb dominant bins = " << bins.size() << std::endl;
+  nbok += ( bins.size() == 3 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "three dominant bins" << std::endl;
+  bool close = bins.size() == 3;
+  for ( Size k = 0; close && ( k < 3 ); ++k )
+    {
+      const Vector d = accumulator.representativeDirection( bins[ k ].first, bins[ k ].second ).getNormalized();
+      trace.info() << "Dominant direction " << d << std::endl;
+      close = d.dot( axes[ k ] ) > 0.99;
+    }
+  nbok += close ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "dominant directions by decreasing size" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -211,7 +311,8 @@ int main( int argc, char** argv )
   trace.info() << endl;
 
   bool res = testSphericalAccumulator() && testSphericalMore()
-    && testSphericalMoreIntegerDir();
+    && testSphericalMoreIntegerDir() && testSphericalBatchAndMerge()
+    && testSphericalDominantBins();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,237 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFastSweeping.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing classes FastSweeping and the candidate queues
+ * of FMM.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/DomainPredicate.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/FMM.h"
+#include "DGtal/geometry/volumes/distance/FastSweeping.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class FastSweeping.
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename Domain, typename Queue>
+std::vector<double>
+fmmDistances( const Domain& domain,
+              const std::vector<typename Domain::Point>& seeds,
+              double threshold )
+{
+  typedef ImageContainerBySTLVector<Domain, double> Image;
+  typedef DigitalSetBySTLSet<Domain>                Set;
+  typedef functors::DomainPredicate<Domain>                   Predicate;
+  typedef L2FirstOrderLocalDistance<Image, Set>     Distance;
+  typedef FMM<Image, Set, Predicate, Distance, Queue> FMM;
+  Image image( domain );
+  Set   set( domain );
+  Predicate predicate( domain );
+  FMM::initFromPointsRange( seeds.begin(), seeds.end(), image, set, 0.0 );
+  FMM fmm( image, set, predicate, domain.size() + 1, threshold );
+  fmm.compute();
+  std::vector<double> result;
+  for ( auto p : domain )
+    result.push_back( set.find( p ) != set.end() ? image( p ) : -1.0 );
+  return result;
+}
+
+template <typename Domain>
+std::vector<double>
+sweepingDistances( const Domain& domain,
+                   const std::vector<typename Domain::Point>& seeds,
+                   double threshold, unsigned int& nbIterations )
+{
+  typedef ImageContainerBySTLVector<Domain, double> Image;
+  typedef DigitalSetBySTLSet<Domain>                Set;
+  typedef functors::DomainPredicate<Domain>                   Predicate;
+  typedef FastSweeping<Image, Set, Predicate>       Sweeping;
+  Image image( domain );
+  Set   set( domain );
+  Predicate predicate( domain );
+  for ( auto p : seeds ) { set.insert( p ); image.setValue( p, 0.0 ); }
+  Sweeping sweeping( image, set, predicate, threshold );
+  nbIterations = sweeping.compute();
+  REQUIRE( sweeping.isValid() );
+  std::vector<double> result;
+  for ( auto p : domain )
+    result.push_back( set.find( p ) != set.end() ? image( p ) : -1.0 );
+  return result;
+}
+
+double maxDifference( const std::vector<double>& v1, const std::vector<double>& v2 )
+{
+  double d = 0.0;
+  for ( std::size_t i = 0; i < v1.size(); ++i )
+    d = std::max( d, std::abs( v1[ i ] - v2[ i ] ) );
+  return d;
+}
+
+SCENARIO( "FMM candidate queues", "[fmm][queue]" )
+{
+  typedef SpaceND<2, int>           Space;
+  typedef HyperRectDomain<Space>    Domain;
+  typedef Domain::Point             Point;
+  Domain domain( Point( -20, -15 ), Point( 25, 20 ) );
+  std::vector<Point> seeds = { Point( 0, 0 ), Point( 10, 12 ), Point( -12, 3 ) };
+
+  GIVEN( "Random insertions in an indexed heap" ) {
+    IndexedHeapCandidateQueue<Point, double> heap;
+    STLSetCandidateQueue<Point, double>      set;
+    heap.init( Point( 0, 0 ), Point( 19, 19 ) );
+    srand( 0 );
+    for ( int i = 0; i < 500; ++i ) {
+      Point p( rand() % 20, rand() % 20 );
+      double v = (double) ( rand() % 1000 ) / 10.0;
+      heap.push( p, v );
+      set.push( p, v );
+    }
+    REQUIRE( heap.isValid() );
+    THEN( "Points are extracted in the same order as with a STL set" ) {
+      std::vector<Point> extracted;
+      unsigned int nb_diff = 0;
+      while ( ! heap.empty() ) {
+        while ( std::find( extracted.begin(), extracted.end(), set.top().first )
+                != extracted.end() )
+          set.pop();
+        if ( heap.top() != set.top() ) nb_diff++;
+        extracted.push_back( heap.top().first );
+        heap.pop();
+        set.pop();
+      }
+      REQUIRE( nb_diff == 0 );
+      REQUIRE( heap.isValid() );
+      heap.push( Point( 3, 4 ), 1.0 );
+      heap.push( Point( 19, 0 ), 2.0 );
+      heap.clear();
+      REQUIRE( heap.empty() );
+      REQUIRE( heap.isValid() );
+    }
+  }
+  GIVEN( "Distances computed by FMM with several fronts" ) {
+    auto d_set  = fmmDistances< Domain, STLSetCandidateQueue<Point, double> >
+      ( domain, seeds, 1000.0 );
+    auto d_heap = fmmDistances< Domain, IndexedHeapCandidateQueue<Point, double> >
+      ( domain, seeds, 1000.0 );
+    auto d_bucket = fmmDistances< Domain, BucketCandidateQueue<Point, double, 16> >
+      ( domain, seeds, 1000.0 );
+    THEN( "The heap gives exactly the same values as the STL set" ) {
+      REQUIRE( d_set == d_heap );
+    }
+    THEN( "The bucket queue gives close values" ) {
+      REQUIRE( maxDifference( d_set, d_bucket ) < 0.5 );
+    }
+  }
+  GIVEN( "A bucket queue with huge distance values" ) {
+    typedef BucketCandidateQueue<Point, double, 16> Queue;
+    Queue queue;
+    queue.push( Point( 1, 0 ), 2.0 );
+    queue.push( Point( 0, 0 ), 1.0e300 );
+    queue.push( Point( 2, 0 ), 1.0e15 );
+    queue.push( Point( 3, 0 ), -1.0e200 );
+    THEN( "The number of buckets stays bounded and close values come first" ) {
+      REQUIRE( queue.isValid() );
+      REQUIRE( queue.size() == 4 );
+      REQUIRE( queue.top().first == Point( 1, 0 ) );
+      queue.pop();
+      std::size_t nb = 1;
+      while ( ! queue.empty() ) { queue.pop(); nb++; }
+      REQUIRE( nb == 4 );
+      REQUIRE( queue.isValid() );
+    }
+  }
+}
+
+SCENARIO( "FastSweeping computes the same distances as FMM", "[fmm][fastsweeping]" )
+{
+  GIVEN( "A 2D domain with three seeds" ) {
+    typedef SpaceND<2, int>           Space;
+    typedef HyperRectDomain<Space>    Domain;
+    typedef Domain::Point             Point;
+    Domain domain( Point( -20, -15 ), Point( 25, 20 ) );
+    std::vector<Point> seeds = { Point( 0, 0 ), Point( 10, 12 ), Point( -12, 3 ) };
+    unsigned int nb_iter = 0;
+    auto d_fmm   = fmmDistances< Domain, IndexedHeapCandidateQueue<Point, double> >
+      ( domain, seeds, 1000.0 );
+    auto d_sweep = sweepingDistances( domain, seeds, 1000.0, nb_iter );
+    THEN( "Values are the same" ) {
+      REQUIRE( nb_iter >= 2 );
+      REQUIRE( maxDifference( d_fmm, d_sweep ) < 1e-9 );
+    }
+    THEN( "Accepted points out of the image domain are ignored" ) {
+      typedef ImageContainerBySTLVector<Domain, double> Image;
+      typedef DigitalSetBySTLSet<Domain>                Set;
+      typedef functors::DomainPredicate<Domain>         Predicate;
+      typedef FastSweeping<Image, Set, Predicate>       Sweeping;
+      Domain big_domain( Point( -40, -40 ), Point( 40, 40 ) );
+      Image image( domain );
+      Set   set( big_domain );
+      Predicate predicate( domain );
+      set.insert( Point( 0, 0 ) );
+      image.setValue( Point( 0, 0 ), 0.0 );
+      set.insert( Point( 35, 35 ) );
+      Sweeping sweeping( image, set, predicate, 5.0 );
+      sweeping.compute();
+      REQUIRE( sweeping.isValid() );
+      REQUIRE( set.find( Point( 1, 0 ) ) != set.end() );
+    }
+    THEN( "Values are the same within a narrow band" ) {
+      auto b_fmm   = fmmDistances< Domain, IndexedHeapCandidateQueue<Point, double> >
+        ( domain, seeds, 5.0 );
+      auto b_sweep = sweepingDistances( domain, seeds, 5.0, nb_iter );
+      REQUIRE( maxDifference( b_fmm, b_sweep ) < 1e-9 );
+    }
+  }
+  GIVEN( "A 3D domain with two seeds" ) {
+    typedef SpaceND<3, int>           Space;
+    typedef HyperRectDomain<Space>    Domain;
+    typedef Domain::Point             Point;
+    Domain domain( Point( -8, -6, -7 ), Point( 9, 8, 6 ) );
+    std::vector<Point> seeds = { Point( 0, 0, 0 ), Point( 5, -3, 2 ) };
+    unsigned int nb_iter = 0;
+    auto d_fmm   = fmmDistances< Domain, IndexedHeapCandidateQueue<Point, double> >
+      ( domain, seeds, 1000.0 );
+    auto d_sweep = sweepingDistances( domain, seeds, 1000.0, nb_iter );
+    THEN( "Values are the same" ) {
+      REQUIRE( maxDifference( d_fmm, d_sweep ) < 1e-9 );
+    }
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
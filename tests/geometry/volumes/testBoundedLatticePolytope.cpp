@@ -142,6 +142,79 @@ SCENARIO( "BoundedLatticePolytope< Z2 > unit tests", "[lattice_polytope][2d]" )
   }
 }
 
+SCENARIO( "BoundedLatticePolytope< Z3 > enumeration of large polytopes", "[lattice_polytope][3d][enumeration]" )
+{
+  typedef SpaceND<3,int>                   Space;
+  typedef Space::Point                     Point;
+  typedef BoundedLatticePolytope< Space >  Polytope;
+  typedef Polytope::Domain                 Domain;
+
+  GIVEN( "A simplex whose domain has more than 100000 points" ) {
+    Point a( 0, 0, 0 );
+    Point b( 70, 3, 0 );
+    Point c( 5, 60, 2 );
+    Point d( -4, 7, 50 );
+    Polytope P { a, b, c, d };
+    const Domain& D = P.getDomain();
+    std::vector< Point > expected;
+    for ( const Point& p : D )
+      if ( P.isInside( p ) ) expected.push_back( p );
+    std::vector< Point > pts;
+    P.getPoints( pts );
+    THEN( "Its points are enumerated in the order of its domain" ) {
+      REQUIRE( D.size() > 100000 );
+      REQUIRE( P.count() == (int) expected.size() );
+      REQUIRE( pts == expected );
+    }
+  }
+  GIVEN( "A simplex cut by a strict half-space" ) {
+    Point a( 0, 0, 0 );
+    Point b( 70, 3, 0 );
+    Point c( 5, 60, 2 );
+    Point d( -4, 7, 50 );
+    Polytope P { a, b, c, d };
+    P.cut( Point( 3, -2, 5 ), 120, false );
+    const Domain& D = P.getDomain();
+    std::vector< Point > inside, interior, boundary, within;
+    const Point lo( 10, 5, 3 );
+    const Point hi( 40, 30, 20 );
+    for ( const Point& p : D )
+      {
+        if ( P.isInside( p ) )   inside.push_back( p );
+        if ( P.isInterior( p ) ) interior.push_back( p );
+        if ( P.isBoundary( p ) ) boundary.push_back( p );
+        if ( P.isInside( p ) && lo.isLower( p ) && p.isLower( hi ) )
+          within.push_back( p );
+      }
+    THEN( "Counts computed from rows are the ones of a full scan" ) {
+      REQUIRE( P.count() == (int) inside.size() );
+      REQUIRE( P.countInterior() == (int) interior.size() );
+      REQUIRE( P.countBoundary() == (int) boundary.size() );
+      REQUIRE( P.countWithin( lo, hi ) == (int) within.size() );
+      REQUIRE( P.countUpTo( 100 ) == 100 );
+      REQUIRE( P.countUpTo( 1000000 ) == (int) inside.size() );
+    }
+    THEN( "Points computed from rows are the ones of a full scan" ) {
+      std::vector< Point > pts;
+      P.getPoints( pts );
+      REQUIRE( pts == inside );
+      P.getInteriorPoints( pts );
+      REQUIRE( pts == interior );
+      P.getBoundaryPoints( pts );
+      REQUIRE( pts == boundary );
+    }
+    THEN( "Rows and points may be visited without being stored" ) {
+      std::vector< Point > pts;
+      int nb = 0;
+      P.forEachRow( [&nb] ( const Point& first, const Point& last )
+                    { nb += last[ 0 ] - first[ 0 ] + 1; } );
+      P.forEachPoint( [&pts] ( const Point& p ) { pts.push_back( p ); } );
+      REQUIRE( nb == (int) inside.size() );
+      REQUIRE( pts == inside );
+    }
+  }
+}
+
 SCENARIO( "BoundedLatticePolytope< Z3 > unit tests", "[lattice_polytope][3d]" )
 {
   typedef SpaceND<3,int>                   Space;
@@ -297,6 +297,64 @@ SCENARIO( "DigitalConvexity< Z3 > fully convex tetrahedra", "[convex_simplices][
       REQUIRE( nbf == nbfg );
     }
   }
+  WHEN( "Checking full convexity of many tetrahedra with a cache." ) {
+    DConvexity::ConvexityCache cache;
+    DConvexity cdconv( dconv );
+    cdconv.setCache( &cache );
+    std::vector< std::vector< Point > > sets;
+    for ( unsigned int i = 0; i < 50; ++i )
+      {
+        Point a( rand() % 5, rand() % 5, rand() % 5 );
+        Point b( rand() % 5, rand() % 5, rand() % 5 );
+        Point c( rand() % 5, rand() % 5, rand() % 5 );
+        Point d( rand() % 5, rand() % 5, rand() % 5 );
+        if ( ! dconv.isSimplexFullDimensional( { a, b, c, d } ) ) continue;
+        std::vector< Point > X;
+        dconv.makeSimplex( { a, b, c, d } ).getPoints( X );
+        sets.push_back( X );
+      }
+    unsigned int nb_diff = 0;
+    for ( unsigned int pass = 0; pass < 2; ++pass )
+      for ( auto X : sets )
+        {
+          if ( pass == 1 ) std::reverse( X.begin(), X.end() );
+          if ( dconv.isFullyConvex( X ) != cdconv.isFullyConvex( X ) )
+            nb_diff += 1;
+        }
+    THEN( "Results are the same with or without cache." ) {
+      REQUIRE( sets.size() > 0 );
+      REQUIRE( nb_diff == 0 );
+    }
+    THEN( "The second pass only uses cached results, whatever the order of points." ) {
+      REQUIRE( cache.size() > 0 );
+      REQUIRE( cache.hits() >= sets.size() );
+      REQUIRE( cache.hits() + cache.misses() > cache.size() );
+    }
+  }
+  WHEN( "Two distinct point sets collide in the cache." ) {
+    // Stores a result for a range under the key of another range.
+    struct CollidingCache : public DConvexity::ConvexityCache {
+      void collide( const std::vector< Point >& X, const std::vector< Point >& Y, bool value )
+      {
+        myMap[ key( X ) ].push_back( Entry( sorted( Y ), value ) );
+        ++myNb;
+      }
+    } cache;
+    DConvexity cdconv( dconv );
+    cdconv.setCache( &cache );
+    std::vector< Point > X = { Point( 0, 0, 0 ), Point( 1, 0, 0 ), Point( 0, 1, 0 ), Point( 1, 1, 0 ) };
+    std::vector< Point > Y = { Point( 0, 0, 0 ), Point( 2, 0, 0 ) };
+    cache.collide( X, Y, false );
+    THEN( "The result of the other set is not returned." ) {
+      REQUIRE( cache.get( X ).second == false );
+      REQUIRE( cdconv.is0Convex( X ) );
+      REQUIRE( cdconv.isFullyConvex( X ) );
+      REQUIRE( cache.get( X ).second == true );
+      REQUIRE( cache.get( X ).first == true );
+      std::reverse( Y.begin(), Y.end() );
+      REQUIRE( cache.get( Y ).second == false );
+    }
+  }
 }
 
 SCENARIO( "DigitalConvexity< Z3 > rational fully convex tetrahedra", "[convex_simplices][3d][rational]" )
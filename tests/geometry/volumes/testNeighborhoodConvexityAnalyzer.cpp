@@ -0,0 +1,163 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testNeighborhoodConvexityAnalyzer.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class NeighborhoodConvexityAnalyzer and
+ * ConvexityConfigurationTable.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/geometry/volumes/NeighborhoodConvexityAnalyzer.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class NeighborhoodConvexityAnalyzer.
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "ConvexityConfigurationTable symmetries", "[convexity_table][3d]" )
+{
+  typedef ConvexityConfigurationTable< 3, 1 > Table;
+  typedef Table::Configuration                Configuration;
+  Table table( 8 );
+  REQUIRE( table.nbSymmetries() == 48 );
+  srand( 0 );
+  Configuration cfg;
+  for ( std::size_t b = 0; b < Table::neigh_size; b++ )
+    if ( rand() % 2 ) cfg.set( b );
+  unsigned int nb_same_count     = 0;
+  unsigned int nb_same_canonical = 0;
+  const Configuration canonical_cfg = table.canonical( cfg );
+  for ( std::size_t s = 0; s < table.nbSymmetries(); s++ )
+    {
+      const Configuration other = table.transform( cfg, s );
+      nb_same_count     += ( other.count() == cfg.count() ) ? 1 : 0;
+      nb_same_canonical += ( table.canonical( other ) == canonical_cfg ) ? 1 : 0;
+    }
+  REQUIRE( nb_same_count     == table.nbSymmetries() );
+  REQUIRE( nb_same_canonical == table.nbSymmetries() );
+  // Values are shared by symmetric configurations.
+  table.set( cfg, Table::FullConvexity, true );
+  auto p = table.get( table.transform( cfg, 17 ), Table::FullConvexity );
+  REQUIRE( p.second );
+  REQUIRE( p.first );
+  auto q = table.get( cfg, Table::ZeroConvexity );
+  REQUIRE( ! q.second );
+}
+
+SCENARIO( "NeighborhoodConvexityAnalyzer incremental and parallel scans", "[neighborhood][3d]" )
+{
+  typedef KhalimskySpaceND< 3, int > KSpace;
+  typedef KSpace::Point              Point;
+  typedef HyperRectDomain< KSpace::Space > Domain;
+  typedef DigitalSetBySTLSet< Domain > DigitalSet;
+  typedef NeighborhoodConvexityAnalyzer< KSpace, 1 > NCA;
+  const Point lo( 0, 0, 0 );
+  const Point hi( 11, 10, 9 );
+  Domain domain( lo, hi );
+  // A noisy ball
+  DigitalSet X( domain );
+  srand( 0 );
+  for ( auto p : domain )
+    {
+      const Point d = p - Point( 5, 5, 4 );
+      const bool in_ball = d.dot( d ) <= 16;
+      if ( in_ball != ( rand() % 25 == 0 ) ) X.insert( p );
+    }
+  NCA nca( lo, hi );
+  GIVEN( "A center translated along each axis" ) {
+    NCA nca2( lo, hi );
+    unsigned int nb_wrong_cfg  = 0;
+    unsigned int nb_wrong_flag = 0;
+    for ( Dimension k = 0; k < 3; k++ )
+      {
+        Point start = lo;
+        start[ ( k + 1 ) % 3 ] = 3;
+        nca.setCenter( start, X );
+        for ( int i = 1; i <= hi[ k ]; i++ )
+          {
+            nca.translateCenter( k, X );
+            Point c = start;
+            c[ k ] += i;
+            nca2.setCenter( c, X );
+            if ( nca.center() != c
+                 || nca.configuration() != nca2.configuration() )
+              nb_wrong_cfg += 1;
+            if ( nca.isCenterInX() != nca2.isCenterInX()
+                 || nca.isFullyConvexCollapsible() != nca2.isFullyConvexCollapsible() )
+              nb_wrong_flag += 1;
+          }
+      }
+    THEN( "Configurations are the same as the ones computed from scratch" ) {
+      REQUIRE( nb_wrong_cfg  == 0 );
+      REQUIRE( nb_wrong_flag == 0 );
+    }
+  }
+  GIVEN( "A scan of the domain with a shared configuration table" ) {
+    std::vector< Point > noise;
+    std::vector< Point > collapsible;
+    for ( auto p : domain )
+      {
+        nca.setCenter( p, X );
+        if ( nca.isLikelyNoise() )             noise.push_back( p );
+        if ( nca.isFullyConvexCollapsible() ) collapsible.push_back( p );
+      }
+    NCA::ConfigurationTable table;
+    NCA nca_table( lo, hi );
+    nca_table.setConfigurationTable( &table );
+    auto scan_noise = nca_table.scan
+      ( X, [] ( NCA& n ) { return n.isLikelyNoise(); } );
+    auto scan_collapsible = nca_table.scan
+      ( X, [] ( NCA& n ) { return n.isFullyConvexCollapsible(); } );
+    THEN( "The same points are found" ) {
+      REQUIRE( collapsible.size() > 0 );
+      REQUIRE( scan_noise == noise );
+      REQUIRE( scan_collapsible == collapsible );
+      REQUIRE( table.size() > 0 );
+    }
+    THEN( "Sub-regions can be scanned" ) {
+      Domain region( Point( 2, 3, 1 ), Point( 8, 7, 6 ) );
+      std::vector< Point > region_collapsible;
+      for ( auto p : collapsible )
+        if ( region.isInside( p ) ) region_collapsible.push_back( p );
+      auto scan_region = nca_table.scan
+        ( X, [] ( NCA& n ) { return n.isFullyConvexCollapsible(); }, region );
+      REQUIRE( region_collapsible.size() > 0 );
+      REQUIRE( scan_region == region_collapsible );
+    }
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
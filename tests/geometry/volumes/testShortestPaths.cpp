@@ -50,13 +50,8 @@ SCENARIO( "TangencyComputer::ShortestPaths 3D tests", "[shortest_paths][3d][tang
 {
   typedef Z3i::Space          Space;
   typedef Z3i::KSpace         KSpace;
-  typedef Z3i::Domain         Domain;
-  typedef Z3i::SCell          SCell;
   typedef Shortcuts< KSpace > SH3;
   typedef Space::Point        Point;
-  typedef Space::RealPoint    RealPoint;
-  typedef Space::RealVector   RealVector;
-  typedef Space::Vector       Vector;
   typedef std::size_t         Index;
   
   SECTION( "Computing shortest paths on a 3D unit sphere digitized at gridstep 0.125" )
@@ -135,5 +130,92 @@ SCENARIO( "TangencyComputer::ShortestPaths 3D tests", "[shortest_paths][3d][tang
       // AND_THEN( "This distance is greater or equal to the exacts shortest path" )
       REQUIRE( last_distance_opt*h >= last_distance*h );
     }
+
+  SECTION( "Reusing shortest paths workspaces and computing several distance fields" )
+    {
+      // Make digital sphere
+      const double h = 0.25;
+      auto   params  = SH3::defaultParameters();
+      params( "polynomial", "sphere1" )( "gridstep",  h );
+      params( "minAABB", -2)( "maxAABB", 2)( "offset", 1.0 )( "closed", 1 );
+      auto implicit_shape  = SH3::makeImplicitShape3D  ( params );
+      auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+      auto K            = SH3::getKSpace( params );
+      auto binary_image = SH3::makeBinaryImage(digitized_shape,
+                                               SH3::Domain(K.lowerBound(),K.upperBound()),
+                                               params );
+      auto surface = SH3::makeDigitalSurface( binary_image, K, params );
+      std::vector< Point >    lattice_points;
+      auto pointels = SH3::getPointelRange( surface );
+      for ( auto p : pointels ) lattice_points.push_back( K.uCoords( p ) );
+      const Index nb = lattice_points.size();
+      TangencyComputer< KSpace > TC( K );
+      TC.init( lattice_points.cbegin(), lattice_points.cend() );
+      std::vector< Index > sources = { 0, nb / 3, nb / 2, nb - 1 };
+      // Reference distances, with a new object for each source.
+      std::vector< std::vector< double > > ref_distances;
+      for ( auto s : sources )
+        {
+          auto SP = TC.makeShortestPaths( sqrt(3.0) );
+          SP.init( s );
+          while ( ! SP.finished() ) SP.expand();
+          ref_distances.push_back( SP.distances() );
+        }
+      auto max_error = [] ( const std::vector< double >& d1,
+                            const std::vector< double >& d2 )
+        {
+          double e = 0.0;
+          for ( std::size_t i = 0; i < d1.size(); i++ )
+            e = std::max( e, std::abs( d1[ i ] - d2[ i ] ) );
+          return e;
+        };
+      // Reuse the same object
+      auto SP = TC.makeShortestPaths( sqrt(3.0) );
+      unsigned int nb_different = 0;
+      for ( std::size_t k = 0; k < sources.size(); k++ )
+        {
+          SP.clear();
+          SP.init( sources[ k ] );
+          while ( ! SP.finished() ) SP.expand();
+          if ( max_error( SP.distances(), ref_distances[ k ] ) > 1e-10 )
+            nb_different += 1;
+        }
+      // THEN( "A cleared object computes the same distances as a new one" )
+      REQUIRE( nb_different == 0 );
+      auto D = TC.geodesicDistances( sources, sqrt(3.0) );
+      REQUIRE( D.size() == sources.size() );
+      for ( std::size_t k = 0; k < sources.size(); k++ )
+        REQUIRE( max_error( D[ k ], ref_distances[ k ] ) < 1e-10 );
+      // Cached cotangent points
+      TC.cacheCotangentPoints();
+      REQUIRE( TC.isCotangentCached( 0 ) );
+      REQUIRE( TC.isCotangentCached( nb - 1 ) );
+      auto DC = TC.geodesicDistances( sources, sqrt(3.0) );
+      for ( std::size_t k = 0; k < sources.size(); k++ )
+        REQUIRE( max_error( DC[ k ], ref_distances[ k ] ) < 1e-10 );
+      // Bounded distances
+      const double max_d = 5.0;
+      auto DB = TC.geodesicDistances( sources, sqrt(3.0), max_d );
+      unsigned int nb_wrong = 0;
+      unsigned int nb_inf   = 0;
+      unsigned int nb_far   = 0;
+      for ( std::size_t k = 0; k < sources.size(); k++ )
+        for ( Index i = 0; i < nb; i++ )
+          {
+            if ( DB[ k ][ i ] == std::numeric_limits<double>::infinity() )
+              {
+                nb_inf += 1;
+                if ( ref_distances[ k ][ i ] <= max_d ) nb_wrong += 1;
+              }
+            else if ( std::abs( DB[ k ][ i ] - ref_distances[ k ][ i ] ) > 1e-10 )
+              nb_wrong += 1;
+            else if ( DB[ k ][ i ] > max_d )
+              nb_far += 1;
+          }
+      REQUIRE( nb_wrong == 0 );
+      // THEN( "No returned finite distance exceeds the bound" )
+      REQUIRE( nb_far == 0 );
+      REQUIRE( nb_inf > 0 );
+    }
 }  
 
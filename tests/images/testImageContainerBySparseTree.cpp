@@ -0,0 +1,169 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageContainerBySparseTree.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class ImageContainerBySparseTree.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <random>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySparseTree.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ImageContainerBySparseTree< Z3i::Domain, int >          SparseImage;
+typedef ImageContainerBySTLVector< Z3i::Domain, int >           DenseImage;
+typedef ImageContainerBySparseTree< Z2i::Domain, int, 1, 1 >    SmallSparseImage2;
+
+BOOST_CONCEPT_ASSERT(( concepts::CImage< SparseImage > ));
+BOOST_CONCEPT_ASSERT(( concepts::CImage< SmallSparseImage2 > ));
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerBySparseTree.
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "ImageContainerBySparseTree unit tests", "[image][sparse_tree]" )
+{
+  Z3i::Domain domain( Z3i::Point( -40, -20, -3 ), Z3i::Point( 60, 50, 70 ) );
+  SparseImage image( domain, 7 );
+  DenseImage  dense( domain );
+  for ( auto p : domain ) dense.setValue( p, 7 );
+  REQUIRE( image.isValid() );
+  REQUIRE( image.nbNodes() == 0 );
+
+  GIVEN( "A narrow band around a sphere" ) {
+    for ( auto p : domain )
+      {
+        const int d = int( std::floor( std::sqrt( double( ( p - Z3i::Point( 10, 15, 30 ) ).squaredNorm() ) ) ) ) - 25;
+        if ( std::abs( d ) <= 2 )
+          {
+            image.setValue( p, d );
+            dense.setValue( p, d );
+          }
+      }
+    THEN( "Values are those of a dense image and only bricks near the band are stored" ) {
+      for ( auto p : domain ) REQUIRE( image( p ) == dense( p ) );
+      SparseImage::ConstAccessor acc( image );
+      for ( auto p : domain ) REQUIRE( acc( p ) == dense( p ) );
+      REQUIRE( image.nbLeaves() > 0 );
+      REQUIRE( image.nbLeaves() * SparseImage::leaf_size < domain.size() );
+      REQUIRE( image.memoryUsage() < domain.size() * sizeof( int ) );
+    }
+    THEN( "Leaves can be modified in parallel" ) {
+      const SparseImage::Size nb = image.nbLeaves();
+      image.forEachLeaf( [] ( const Z3i::Point&, int* values )
+                         {
+                           for ( std::size_t i = 0; i < SparseImage::leaf_size; ++i )
+                             values[ i ] += 100;
+                         } );
+      REQUIRE( image.nbLeaves() == nb );
+      std::size_t nb_leaves = 0;
+      const SparseImage& cimage = image;
+      cimage.forEachLeaf( [&] ( const Z3i::Point& origin, const int* values )
+                          {
+                            #pragma omp critical
+                            {
+                              ++nb_leaves;
+                              REQUIRE( ( origin - domain.lowerBound() )[ 2 ] % 8 == 0 );
+                              const Z3i::Point q = origin + Z3i::Point( 1, 2, 3 );
+                              if ( domain.isInside( q ) )
+                                REQUIRE( values[ SparseImage::leafOffset( q - domain.lowerBound() ) ]
+                                         == dense( q ) + 100 );
+                            }
+                          } );
+      REQUIRE( nb_leaves == nb );
+    }
+    THEN( "Copies are deep and conversions are exact" ) {
+      SparseImage copy( image );
+      DenseImage out( domain );
+      copy.exportTo( out );
+      for ( auto p : domain ) REQUIRE( out( p ) == dense( p ) );
+      copy.setValue( Z3i::Point( 10, 15, 55 ), 1000 );
+      REQUIRE( image( Z3i::Point( 10, 15, 55 ) ) == dense( Z3i::Point( 10, 15, 55 ) ) );
+      SparseImage other( domain, 7 );
+      other.assign( dense );
+      REQUIRE( other.nbLeaves() == image.nbLeaves() );
+      for ( auto p : domain ) REQUIRE( other( p ) == dense( p ) );
+    }
+  }
+
+  GIVEN( "A filled box and values written back to the background" ) {
+    const Z3i::Point lo( -30, -10, 0 ), hi( 41, 30, 30 );
+    image.fill( lo, hi, 3 );
+    for ( auto p : Z3i::Domain( lo, hi ) ) dense.setValue( p, 3 );
+    THEN( "Covered leaves are tiles and others are bricks" ) {
+      for ( auto p : domain ) REQUIRE( image( p ) == dense( p ) );
+      REQUIRE( image.nbTiles() > 0 );
+      REQUIRE( image.nbLeaves() > 0 );
+      std::size_t nb_points = 0;
+      image.forEachTile( [&] ( const Z3i::Point& origin, const int& v )
+                         {
+                           REQUIRE( v == 3 );
+                           REQUIRE( image( origin ) == 3 );
+                           nb_points += SparseImage::leaf_size;
+                         } );
+      REQUIRE( nb_points == image.nbTiles() * SparseImage::leaf_size );
+    }
+    THEN( "Pruning gives tiles then removes background nodes" ) {
+      const SparseImage::Size nb_tiles = image.nbTiles();
+      image.prune();
+      REQUIRE( image.nbTiles() == nb_tiles );
+      for ( auto p : domain ) REQUIRE( image( p ) == dense( p ) );
+      SparseImage::Accessor acc( image );
+      for ( auto p : Z3i::Domain( lo, hi ) ) acc.setValue( p, 7 );
+      REQUIRE( image.nbNodes() > 0 );
+      image.prune();
+      REQUIRE( image.nbNodes() == 0 );
+      REQUIRE( image.nbLeaves() == 0 );
+    }
+  }
+
+  GIVEN( "A 2D image with tiny leaves and nodes" ) {
+    Z2i::Domain domain2( Z2i::Point( -5, -7 ), Z2i::Point( 9, 4 ) );
+    SmallSparseImage2 image2( domain2, 0 );
+    std::mt19937 gen( 3 );
+    std::uniform_int_distribution< int > U( 0, 3 );
+    ImageContainerBySTLVector< Z2i::Domain, int > dense2( domain2 );
+    for ( auto p : domain2 ) dense2.setValue( p, U( gen ) );
+    SmallSparseImage2::Accessor acc( image2 );
+    for ( auto p : domain2 ) acc.setValue( p, dense2( p ) );
+    THEN( "Values are those of the dense image, also through the range" ) {
+      REQUIRE( SmallSparseImage2::leaf_size == 4 );
+      auto it = dense2.constRange().begin();
+      for ( auto v : image2.constRange() ) REQUIRE( v == *it++ );
+      image2.prune();
+      for ( auto p : domain2 ) REQUIRE( image2( p ) == dense2( p ) );
+    }
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,114 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImagePipeline.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing the fused image pipelines.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <functional>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImagePipeline.h"
+#include "DGtal/io/Color.h"
+#include "DGtal/io/colormaps/GradientColorMap.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing the fused image pipelines.
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "Image pipelines", "[image][pipeline]" )
+{
+  typedef ImageContainerBySTLVector< Z3i::Domain, int >   IntImage;
+  typedef ImageContainerBySTLVector< Z3i::Domain, float > FloatImage;
+  Z3i::Domain domain( Z3i::Point( -7, 0, 3 ), Z3i::Point( 300, 20, 13 ) );
+  IntImage   a( domain );
+  FloatImage b( domain );
+  for ( auto p : domain )
+    {
+      a.setValue( p, ( p[ 0 ] * 13 + p[ 1 ] * 7 + p[ 2 ] ) % 256 );
+      b.setValue( p, 0.5f * float( p[ 0 ] - p[ 2 ] ) );
+    }
+
+  GIVEN( "A chain of point-wise operations" ) {
+    auto scaled = pipeline::map( pipeline::source( a ),
+                                 [] ( int v ) { return 2.0f * float( v ); } );
+    auto sum    = pipeline::combine( scaled, pipeline::source( b ), std::plus< float >() );
+    auto binary = pipeline::threshold( sum, 100.0f, 400.0f );
+    THEN( "Row evaluation, point evaluation and materialisation agree" ) {
+      auto image = pipeline::materialise( sum );
+      auto seq   = pipeline::materialise( sum, false );
+      auto bin   = pipeline::materialise( binary );
+      for ( auto p : domain )
+        {
+          const float expected = 2.0f * float( a( p ) ) + b( p );
+          REQUIRE( sum( p ) == expected );
+          REQUIRE( image( p ) == expected );
+          REQUIRE( seq( p ) == expected );
+          REQUIRE( bin( p ) == ( ( 100.0f < expected ) && ( expected <= 400.0f ) ) );
+        }
+      REQUIRE( image.domain().lowerBound() == domain.lowerBound() );
+      REQUIRE( image.domain().upperBound() == domain.upperBound() );
+    }
+  }
+
+  GIVEN( "A sub-sampled pipeline ending with a colour map" ) {
+    GradientColorMap< int > cmap( 0, 255 );
+    cmap.addColor( Color::Blue );
+    cmap.addColor( Color::Red );
+    const Z3i::Point steps( 3, 2, 5 );
+    auto colours = pipeline::map( pipeline::subsample( pipeline::source( a ), steps ), cmap );
+    auto image   = pipeline::materialise( colours );
+    THEN( "The domain is sub-sampled and values are those of the source points" ) {
+      REQUIRE( image.domain().lowerBound() == domain.lowerBound() );
+      REQUIRE( image.domain().upperBound() == Z3i::Point( -7 + 307 / 3, 10, 3 + 10 / 5 ) );
+      for ( auto p : image.domain() )
+        {
+          const Z3i::Point q( -7 + ( p[ 0 ] + 7 ) * 3, p[ 1 ] * 2, 3 + ( p[ 2 ] - 3 ) * 5 );
+          REQUIRE( image( p ) == cmap( a( q ) ) );
+        }
+    }
+  }
+
+  GIVEN( "A source image which is not stored in a vector" ) {
+    ImageContainerBySTLMap< Z3i::Domain, int > m( domain, 5 );
+    m.setValue( Z3i::Point( 10, 10, 10 ), 42 );
+    auto image = pipeline::materialise( pipeline::combine( pipeline::source( m ), pipeline::source( a ),
+                                                           std::minus< int >() ) );
+    THEN( "It is read point by point" ) {
+      for ( auto p : domain )
+        REQUIRE( image( p ) == m( p ) - a( p ) );
+    }
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,168 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBinaryPointListReader.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing classes BinaryPointListReader and BinaryPointListWriter.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <cstring>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/io/readers/BinaryPointListReader.h"
+#include "DGtal/io/writers/BinaryPointListWriter.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing classes BinaryPointListReader and BinaryPointListWriter.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing BinaryPointListReader and BinaryPointListWriter" )
+{
+  srand( 0 );
+  std::vector<Z3i::Point> points;
+  std::vector<double>     attributes;
+  for ( int i = 0; i < 100; ++i )
+    {
+      points.push_back( Z3i::Point( rand() % 2000 - 1000, rand() % 2000 - 1000, rand() % 2000 - 1000 ) );
+      attributes.push_back( i * 0.5 );
+      attributes.push_back( -i );
+    }
+
+  SECTION( "Points and attributes are read back, block after block" )
+    {
+      std::stringstream stream( std::ios::in | std::ios::out | std::ios::binary );
+      BinaryPointListWriter<Z3i::Point> writer( stream, 2, 7 );
+      writer.write( std::vector<Z3i::Point>( points.begin(), points.begin() + 10 ),
+                    std::vector<double>( attributes.begin(), attributes.begin() + 20 ) );
+      writer.write( std::vector<Z3i::Point>( points.begin() + 10, points.end() ),
+                    std::vector<double>( attributes.begin() + 20, attributes.end() ) );
+      writer.close();
+      REQUIRE( writer.size() == points.size() );
+
+      std::vector<Z3i::Point> readPoints;
+      std::vector<double>     readAttributes;
+      std::size_t nbBlocks = 0, maxBlockSize = 0;
+      std::size_t nb = BinaryPointListReader<Z3i::Point>::processPointsFromInputStream
+        ( stream, [&] ( const std::vector<Z3i::Point>& block, const std::vector<double>& blockAttributes )
+          {
+            ++nbBlocks;
+            maxBlockSize = std::max( maxBlockSize, block.size() );
+            readPoints.insert( readPoints.end(), block.begin(), block.end() );
+            readAttributes.insert( readAttributes.end(), blockAttributes.begin(), blockAttributes.end() );
+          } );
+      REQUIRE( nb == points.size() );
+      REQUIRE( nbBlocks == 15 );
+      REQUIRE( maxBlockSize == 7 );
+      REQUIRE( readPoints == points );
+      REQUIRE( readAttributes == attributes );
+    }
+
+  SECTION( "Coordinates are converted to the components of the read points" )
+    {
+      std::stringstream stream( std::ios::in | std::ios::out | std::ios::binary );
+      {
+        BinaryPointListWriter<Z3i::Point> writer( stream );
+        writer.write( points );
+      }
+      std::vector<Z3i::RealPoint> readPoints =
+        BinaryPointListReader<Z3i::RealPoint>::getPointsFromInputStream( stream );
+      REQUIRE( readPoints.size() == points.size() );
+      bool same = true;
+      for ( std::size_t i = 0; i < points.size(); ++i )
+        same = same && readPoints[ i ] == Z3i::RealPoint( points[ i ][ 0 ], points[ i ][ 1 ], points[ i ][ 2 ] );
+      REQUIRE( same );
+    }
+
+  SECTION( "Files written with the other byte order are swapped" )
+    {
+      std::stringstream stream( std::ios::in | std::ios::out | std::ios::binary );
+      BinaryPointListWriter<Z3i::Point> writer( stream, 2 );
+      writer.write( points, attributes );
+      writer.close();
+      // Swaps the bytes of each field of the header, block and values.
+      std::string bytes = stream.str();
+      std::size_t pos = 8;
+      std::vector< std::pair< std::size_t, std::size_t > > fields; // (size, number)
+      fields.push_back( std::make_pair( 4, 6 ) );
+      fields.push_back( std::make_pair( 8, 1 ) );
+      fields.push_back( std::make_pair( sizeof( Z3i::Integer ), 3 * points.size() ) );
+      fields.push_back( std::make_pair( 8, 2 * points.size() ) );
+      fields.push_back( std::make_pair( 8, 1 ) );
+      for ( auto field : fields )
+        for ( std::size_t i = 0; i < field.second; ++i, pos += field.first )
+          std::reverse( bytes.begin() + pos, bytes.begin() + pos + field.first );
+      REQUIRE( pos == bytes.size() );
+      std::istringstream swapped( bytes, std::ios::in | std::ios::binary );
+      std::vector<double> readAttributes;
+      std::vector<Z3i::Point> readPoints =
+        BinaryPointListReader<Z3i::Point>::getPointsFromInputStream( swapped, &readAttributes );
+      REQUIRE( readPoints == points );
+      REQUIRE( readAttributes == attributes );
+    }
+
+  SECTION( "Invalid streams are rejected" )
+    {
+      std::stringstream stream( std::ios::in | std::ios::out | std::ios::binary );
+      BinaryPointListWriter<Z3i::Point> writer( stream );
+      writer.write( points );
+      REQUIRE_THROWS_AS( writer.write( points, attributes ), IOException );
+      writer.close();
+      REQUIRE_THROWS_AS( writer.write( points ), IOException );
+      std::istringstream stream2D( stream.str(), std::ios::in | std::ios::binary );
+      REQUIRE_THROWS_AS( BinaryPointListReader<Z2i::Point>::getPointsFromInputStream( stream2D ),
+                         IOException );
+      std::istringstream truncated( stream.str().substr( 0, 100 ), std::ios::in | std::ios::binary );
+      REQUIRE_THROWS_AS( BinaryPointListReader<Z3i::Point>::getPointsFromInputStream( truncated ),
+                         IOException );
+      // A block size larger than the file is rejected before any allocation.
+      std::string huge = stream.str();
+      const DGtal::uint64_t n = DGtal::uint64_t( 1 ) << 60;
+      std::memcpy( &huge[ 32 ], &n, sizeof( n ) );
+      std::istringstream hugeBlock( huge, std::ios::in | std::ios::binary );
+      REQUIRE_THROWS_AS( BinaryPointListReader<Z3i::Point>::getPointsFromInputStream( hugeBlock ),
+                         IOException );
+      std::istringstream text( "1 2 3\n4 5 6\n7 8 9\n10 11 12\n" );
+      REQUIRE_THROWS_AS( BinaryPointListReader<Z3i::Point>::getPointsFromInputStream( text ),
+                         IOException );
+    }
+
+  SECTION( "Points are exported to and imported from files" )
+    {
+      BinaryPointListWriter<Z3i::Point>::exportFile( "binaryPointList.dpl", points, 2, attributes );
+      std::vector<double> readAttributes;
+      REQUIRE( BinaryPointListReader<Z3i::Point>::getPointsFromFile( "binaryPointList.dpl", &readAttributes )
+               == points );
+      REQUIRE( readAttributes == attributes );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -33,6 +33,8 @@
 #include "DGtal/io/readers/PointListReader.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/geometry/curves/FreemanChain.h" 
+#include <sstream>
+#include <clocale>
 
 #include "ConfigTest.h"
 
@@ -116,6 +118,59 @@ bool testPointListReader()
   nb++;
   trace.endBlock();
 
+  trace.beginBlock ( "Testing reading points by batches ..." );
+  std::ostringstream text;
+  std::vector< Z3i::Point > expected;
+  for ( int i = 0; i < 10000; ++i ){
+    if ( i % 100 == 0 ) text << "# comment " << i << "\n\n";
+    expected.push_back( Z3i::Point( i, -i, 2 * i ) );
+    text << "\t" << i << " " << -i << "   " << 2 * i << " " << i % 7 << "\r\n";
+  }
+  text << "10000 -10000 20000"; // last line without end of line
+  expected.push_back( Z3i::Point( 10000, -10000, 20000 ) );
+  std::istringstream textStream( text.str() );
+  std::vector< Z3i::Point > batchPoints;
+  unsigned int nbBatches = 0;
+  std::size_t nbRead = PointListReader< Z3i::Point >::processPointsFromInputStream
+    ( textStream, [&] ( const std::vector< Z3i::Point >& batch ) {
+        ++nbBatches;
+        batchPoints.insert( batchPoints.end(), batch.begin(), batch.end() );
+      }, 1000 );
+  trace.info() << nbRead << " points read in " << nbBatches << " batches." << std::endl;
+  nbok += ( nbRead == expected.size() && nbBatches == 11 && batchPoints == expected ) ? 1 : 0;
+  nb++;
+  // Lines longer than the chunks of the reader.
+  std::istringstream chunkStream( "# a comment longer than a chunk\n1 2 3\n\n456 7 8\n" );
+  LineChunkReader reader( chunkStream, 5 );
+  std::vector< LineChunkReader::Line > lines;
+  std::vector< std::string > allLines;
+  while ( reader.nextLines( lines ) )
+    for ( unsigned int i = 0; i < lines.size(); i++ )
+      allLines.push_back( std::string( lines[ i ].first, lines[ i ].second ) );
+  nbok += ( allLines.size() == 2 && allLines[ 0 ] == "1 2 3" && allLines[ 1 ] == "456 7 8" ) ? 1 : 0;
+  nb++;
+  // Non finite coordinates are rejected, hexadecimal ones are read as 0, like with operator>>.
+  std::istringstream realStream( "1.5 2 -3e2\ninf 1 2\n1 nan 2\n1 2 1e999\n0x1p3 -2.5 7" );
+  std::vector< Z3i::RealPoint > realPoints = PointListReader< Z3i::RealPoint >::getPointsFromInputStream( realStream );
+  nbok += ( realPoints.size() == 2 && realPoints[ 0 ] == Z3i::RealPoint( 1.5, 2, -300 )
+            && realPoints[ 1 ] == Z3i::RealPoint( 0, -2.5, 7 ) ) ? 1 : 0;
+  nb++;
+  // Real values are read in the "C" locale, whatever the global C locale.
+  const std::string oldLocale = std::setlocale( LC_NUMERIC, nullptr );
+  const char* commaLocales[] = { "fr_FR.UTF-8", "fr_FR.utf8", "de_DE.UTF-8", "de_DE.utf8", "fr_FR", "French" };
+  for ( auto name : commaLocales )
+    if ( std::setlocale( LC_NUMERIC, name ) != nullptr ) break;
+  trace.info() << "Reading real points with LC_NUMERIC="
+               << std::setlocale( LC_NUMERIC, nullptr ) << std::endl;
+  std::istringstream localeStream( "1.5 -2.25 3e-1\n" );
+  std::vector< Z3i::RealPoint > localePoints = PointListReader< Z3i::RealPoint >::getPointsFromInputStream( localeStream );
+  std::setlocale( LC_NUMERIC, oldLocale.c_str() );
+  nbok += ( localePoints.size() == 1
+            && localePoints[ 0 ] == Z3i::RealPoint( 1.5, -2.25, 0.3 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "<< std::endl;
+  trace.endBlock();
+
   return nbok == nb;
 }
 
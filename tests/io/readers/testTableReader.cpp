@@ -32,6 +32,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/io/readers/TableReader.h"
 #include "DGtal/helpers/StdDefs.h"
+#include <sstream>
 
 #include "ConfigTest.h"
 
@@ -99,6 +100,32 @@ bool testNumberReader()
   nb++;
   trace.info() << "(" << nbok << "/" << nb << ") "<< std::endl;
   trace.endBlock();
+
+  trace.beginBlock ( "Testing reading lines by batches ..." );
+  std::ostringstream text;
+  for ( unsigned int i = 0; i < 2500; ++i )
+    text << i << " x " << 0.5 * i << ( i % 2 == 0 ? "\n" : " \n# comment\n" );
+  std::istringstream textStream( text.str() );
+  unsigned int nbBatches = 0;
+  bool isOK = true;
+  std::size_t nbLines = TableReader<double>::processLinesElementsFromInputStream
+    ( textStream, [&] ( const std::vector< std::vector<double> >& batch ) {
+        for ( unsigned int k = 0; k < batch.size(); k++ ){
+          const double i = 1000 * nbBatches + k;
+          isOK = isOK && batch[ k ].size() == 2 && batch[ k ][ 0 ] == i && batch[ k ][ 1 ] == 0.5 * i;
+        }
+        ++nbBatches;
+      }, 1000 );
+  trace.info() << nbLines << " lines read in " << nbBatches << " batches." << std::endl;
+  nbok += ( isOK && nbLines == 2500 && nbBatches == 3 ) ? 1 : 0;
+  nb++;
+  // The last line is read even without end of line character.
+  std::istringstream lastLineStream( "1 2\n3 4" );
+  std::vector< std::vector<int> > lastLines = TableReader<int>::getLinesElementsFromInputStream( lastLineStream );
+  nbok += ( lastLines.size() == 2 && lastLines[ 1 ].size() == 2 && lastLines[ 1 ][ 1 ] == 4 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "<< std::endl;
+  trace.endBlock();
   
   return nbok == nb;
 }
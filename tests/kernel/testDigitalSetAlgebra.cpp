@@ -0,0 +1,234 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDigitalSetAlgebra.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing DigitalSetByBitmap, DigitalSetByMortonVector
+ * and their set operations.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <vector>
+#include <iterator>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/SetFunctions.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/sets/DigitalSetByBitmap.h"
+#include "DGtal/kernel/sets/DigitalSetByMortonVector.h"
+#include "DGtal/kernel/sets/DigitalSetSelector.h"
+#include "DGtal/kernel/sets/DigitalSetDomain.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing DigitalSetByBitmap and DigitalSetByMortonVector.
+///////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+  typedef std::set< Z3i::Point > Reference;
+
+  /// Random points of the domain, with repetitions.
+  std::vector< Z3i::Point > randomPoints( const Z3i::Domain& domain, unsigned int n )
+  {
+    const Z3i::Point lo = domain.lowerBound();
+    const Z3i::Point extent = domain.upperBound() - lo + Z3i::Point::diagonal( 1 );
+    std::vector< Z3i::Point > pts;
+    for ( unsigned int i = 0; i < n; ++i )
+      pts.push_back( lo + Z3i::Point( rand() % extent[ 0 ], rand() % extent[ 1 ], rand() % extent[ 2 ] ) );
+    return pts;
+  }
+
+  template < typename TSet >
+  Reference asReference( const TSet& S )
+  {
+    return Reference( S.begin(), S.end() );
+  }
+
+  /// Checks all the set services of TSet against std::set.
+  template < typename TSet >
+  void checkSetAlgebra( const Z3i::Domain& domain )
+  {
+    using namespace DGtal::functions::setops;
+    BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet< TSet > ));
+    const std::vector< Z3i::Point > pa = randomPoints( domain, 3000 );
+    const std::vector< Z3i::Point > pb = randomPoints( domain, 500 );
+    TSet A( domain ), B( domain );
+    A.insert( pa.begin(), pa.end() );
+    for ( auto p : pb ) B.insert( p );
+    Reference RA( pa.begin(), pa.end() ), RB( pb.begin(), pb.end() );
+    REQUIRE( A.isValid() );
+    REQUIRE( B.isValid() );
+    REQUIRE( A.size() == RA.size() );
+    REQUIRE( asReference( A ) == RA );
+    REQUIRE( asReference( B ) == RB );
+    for ( auto p : domain )
+      REQUIRE( A( p ) == ( RA.count( p ) == 1 ) );
+
+    // Insertion, find and removal.
+    const Z3i::Point p = *RA.begin();
+    REQUIRE( *A.find( p ) == p );
+    REQUIRE( A.erase( p ) == 1 );
+    REQUIRE( A.erase( p ) == 0 );
+    REQUIRE( A.find( p ) == A.end() );
+    A.insertNew( p );
+    A.insert( p );
+    REQUIRE( A.size() == RA.size() );
+    TSet C( A );
+    C.erase( C.begin() );
+    REQUIRE( C.size() == RA.size() - 1 );
+    C.erase( C.begin(), C.end() );
+    REQUIRE( C.empty() );
+
+    // Set operations, through SetFunctions.
+    Reference R;
+    std::set_union( RA.begin(), RA.end(), RB.begin(), RB.end(), std::inserter( R, R.end() ) );
+    REQUIRE( asReference( A | B ) == R );
+    REQUIRE( asReference( B | A ) == R );
+    R.clear();
+    std::set_intersection( RA.begin(), RA.end(), RB.begin(), RB.end(), std::inserter( R, R.end() ) );
+    REQUIRE( asReference( A & B ) == R );
+    REQUIRE( asReference( B & A ) == R );
+    R.clear();
+    std::set_difference( RA.begin(), RA.end(), RB.begin(), RB.end(), std::inserter( R, R.end() ) );
+    REQUIRE( asReference( A - B ) == R );
+    R.clear();
+    std::set_difference( RB.begin(), RB.end(), RA.begin(), RA.end(), std::inserter( R, R.end() ) );
+    REQUIRE( asReference( B - A ) == R );
+    R.clear();
+    std::set_symmetric_difference( RA.begin(), RA.end(), RB.begin(), RB.end(), std::inserter( R, R.end() ) );
+    REQUIRE( asReference( A ^ B ) == R );
+    TSet D( A );
+    D |= B;
+    D -= B;
+    D ^= A;
+    REQUIRE( D.isValid() );
+    REQUIRE( asReference( D ) == asReference( A & B ) );
+    TSet E( B );
+    E += A;
+    REQUIRE( functions::isEqual( E, A | B ) );
+    REQUIRE( functions::isSubset( A, E ) );
+    REQUIRE( functions::isSubset( A & B, B ) );
+    REQUIRE( ! functions::isSubset( E, B ) );
+    REQUIRE( ! functions::isEqual( A, B ) );
+
+    // Complement and bounding box.
+    std::vector< Z3i::Point > complement;
+    std::back_insert_iterator< std::vector< Z3i::Point > > ito( complement );
+    A.computeComplement( ito );
+    REQUIRE( complement.size() + A.size() == domain.size() );
+    TSet F( domain );
+    F.assignFromComplement( A );
+    REQUIRE( F.isValid() );
+    REQUIRE( F.size() == complement.size() );
+    for ( auto q : complement ) REQUIRE( F( q ) );
+    Z3i::Point lo, up, rlo = *RB.begin(), rup = *RB.begin();
+    for ( auto q : RB ) { rlo = rlo.inf( q ); rup = rup.sup( q ); }
+    B.computeBoundingBox( lo, up );
+    REQUIRE( lo == rlo );
+    REQUIRE( up == rup );
+  }
+}
+
+SCENARIO( "DigitalSetByBitmap and DigitalSetByMortonVector", "[digital_set][set_functions]" )
+{
+  srand( 0 );
+  // The domain size is not a multiple of the word size.
+  const Z3i::Domain domain( Z3i::Point( -5, 3, -7 ), Z3i::Point( 17, 12, 6 ) );
+
+  GIVEN( "Bitmap sets" ) {
+    checkSetAlgebra< DigitalSetByBitmap< Z3i::Domain > >( domain );
+    THEN( "Iteration follows the domain and sets of distinct domains may be combined" ) {
+      DigitalSetByBitmap< Z3i::Domain > A( domain ), B( Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 30, 30, 30 ) ) );
+      const std::vector< Z3i::Point > pts = randomPoints( domain, 400 );
+      A.insert( pts.begin(), pts.end() );
+      std::vector< Z3i::Point > inOrder;
+      for ( auto p : domain ) if ( A( p ) ) inOrder.push_back( p );
+      REQUIRE( std::equal( inOrder.begin(), inOrder.end(), A.begin() ) );
+      for ( auto p : pts ) if ( B.domain().isInside( p ) ) B.insert( p );
+      B.insert( Z3i::Point( 30, 30, 30 ) );
+      DigitalSetByBitmap< Z3i::Domain > C( A );
+      C.assignIntersection( B );
+      REQUIRE( C.isValid() );
+      REQUIRE( C.isSubset( B ) );
+      REQUIRE( C.size() + 1 == B.size() );
+    }
+  }
+
+  GIVEN( "Morton vector sets" ) {
+    typedef DigitalSetByMortonVector< Z3i::Domain > MortonSet;
+    checkSetAlgebra< MortonSet >( domain );
+    THEN( "Points are sorted along the Morton curve of the domain" ) {
+      MortonSet A( domain );
+      const Z3i::Point lo = domain.lowerBound();
+      A.insert( lo + Z3i::Point( 1, 1, 0 ) );
+      A.insert( lo + Z3i::Point( 2, 0, 0 ) );
+      A.insert( lo + Z3i::Point( 0, 0, 1 ) );
+      A.insert( lo + Z3i::Point( 1, 0, 0 ) );
+      A.insert( lo );
+      const std::vector< Z3i::Point > expected =
+        { lo, lo + Z3i::Point( 1, 0, 0 ), lo + Z3i::Point( 1, 1, 0 ),
+          lo + Z3i::Point( 0, 0, 1 ), lo + Z3i::Point( 2, 0, 0 ) };
+      REQUIRE( A.container() == expected );
+    }
+    THEN( "Galloping merges handle very unbalanced sets" ) {
+      using namespace DGtal::functions::setops;
+      MortonSet A( domain ), B( domain );
+      for ( auto p : domain ) A.insertNew( p );
+      B.insert( domain.lowerBound() );
+      B.insert( domain.upperBound() );
+      REQUIRE( A.size() == domain.size() );
+      REQUIRE( ( A & B ).size() == 2 );
+      REQUIRE( ( A - B ).size() == domain.size() - 2 );
+      REQUIRE( ( B | A ).size() == domain.size() );
+      REQUIRE( B.isSubset( A ) );
+    }
+  }
+
+  GIVEN( "The digital set selector" ) {
+    THEN( "Whole sets are bitmaps and medium sets iterated often are Morton vectors" ) {
+      REQUIRE( ( std::is_same< DigitalSetSelector< Z3i::Domain, WHOLE_DS + HIGH_BEL_DS >::Type,
+                 DigitalSetByBitmap< Z3i::Domain > >::value ) );
+      REQUIRE( ( std::is_same< DigitalSetSelector< Z3i::Domain, WHOLE_DS + HIGH_VAR_DS + HIGH_ITER_DS >::Type,
+                 DigitalSetByBitmap< Z3i::Domain > >::value ) );
+      REQUIRE( ( std::is_same< DigitalSetSelector< Z3i::Domain, MEDIUM_DS + HIGH_ITER_DS >::Type,
+                 DigitalSetByMortonVector< Z3i::Domain > >::value ) );
+      REQUIRE( ( std::is_same< DigitalSetSelector< Z3i::Domain, BIG_DS + HIGH_BEL_DS >::Type,
+                 Z3i::DigitalSet >::value ) );
+    }
+    THEN( "Whole sets of other domains are not bitmaps" ) {
+      typedef DigitalSetDomain< Z3i::DigitalSet > SetDomain;
+      REQUIRE( ( std::is_same< DigitalSetSelector< SetDomain, WHOLE_DS + HIGH_BEL_DS >::Type,
+                 DigitalSetByAssociativeContainer< SetDomain, std::unordered_set< Z3i::Point > > >::value ) );
+    }
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
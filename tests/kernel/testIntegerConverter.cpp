@@ -29,6 +29,7 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <sstream>
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/kernel/IntegerConverter.h"
 #include "DGtalCatch.h"
@@ -151,3 +152,47 @@ SCENARIO( "IntegerConverter< 1, BigInteger >", "[integer_conversions]" )
   }
 }
 #endif
+
+#ifdef WITH_INT128
+SCENARIO( "IntegerConverter< 1, int128 >", "[integer_conversions]" )
+{
+  typedef IntegerConverter< 1, DGtal::int128_t > Converter;
+  DGtal::int64_t    big_int64  = 0x123456789ABCDEFL;
+  DGtal::int128_t   big_int128 = DGtal::int128_t( big_int64 ) * DGtal::int128_t( -big_int64 );
+  WHEN( "Converting 64bits and 128bits integers" ) {
+    DGtal::int128_t a = Converter::cast( big_int64 );
+    DGtal::int128_t b = Converter::cast( big_int128 );
+    DGtal::int64_t  c = IntegerConverter< 1, DGtal::int64_t >::cast( a );
+    THEN( "Values are preserved when they fit" ) {
+      REQUIRE( a == big_int64 );
+      REQUIRE( b == big_int128 );
+      REQUIRE( c == big_int64 );
+      REQUIRE( NumberTraits<DGtal::int128_t>::castToInt64_t( a ) == big_int64 );
+      REQUIRE( NumberTraits<DGtal::int128_t>::castToDouble( b ) < -1e33 );
+    }
+  }
+#ifdef WITH_BIGINTEGER
+  WHEN( "Converting from and to BigInteger" ) {
+    DGtal::BigInteger big_bigint = -DGtal::BigInteger( 0x123456789ABCDEFL );
+    big_bigint *= DGtal::BigInteger( 0x123456789ABCDEFL );
+    DGtal::BigInteger a = IntegerConverter< 1, DGtal::BigInteger >::cast( big_int128 );
+    DGtal::int128_t   b = Converter::cast( big_bigint );
+    THEN( "Values are identical" ) {
+      REQUIRE( a == big_bigint );
+      REQUIRE( b == big_int128 );
+    }
+  }
+#endif
+  WHEN( "Writing a 128bits integer" ) {
+    std::ostringstream ss;
+    ss << big_int128;
+    THEN( "It is written in base 10" ) {
+      REQUIRE( ss.str() == "-6721627000907426263151485706741025" );
+      REQUIRE( DGtal::to_string( big_int128 ) == ss.str() );
+      REQUIRE( DGtal::to_string( DGtal::int128_t( 0 ) ) == "0" );
+      REQUIRE( DGtal::to_string( DGtal::uint128_t( 0 ) - 1 )
+               == "340282366920938463463374607431768211455" );
+    }
+  }
+}
+#endif
@@ -201,3 +201,50 @@ TEST_CASE( "BigInteger" )
 }
 
 #endif
+
+#ifdef WITH_INT128
+
+/// Check traits for a 128-bit integer type, without std::numeric_limits
+template <typename T, bool Signed>
+void checkInt128Type()
+{
+  using NT = typename DGtal::NumberTraits<T>;
+  using U  = DGtal::uint128_t;
+
+  REQUIRE_SAME_VALUE( typename NT::IsBounded,     true );
+  REQUIRE_SAME_VALUE( typename NT::IsSigned,      Signed );
+  REQUIRE_SAME_VALUE( typename NT::IsUnsigned,    ! Signed );
+  REQUIRE_SAME_VALUE( typename NT::IsIntegral,    true );
+  REQUIRE_SAME_VALUE( typename NT::IsSpecialized, true );
+
+  REQUIRE_SAME_TYPE( typename NT::ReturnType, T );
+  REQUIRE_SAME_TYPE( typename std::decay<typename NT::ParamType>::type, T );
+  REQUIRE_SAME_TYPE( typename NT::SignedVersion, DGtal::int128_t );
+  REQUIRE_SAME_TYPE( typename NT::UnsignedVersion, DGtal::uint128_t );
+
+  REQUIRE( NT::zero() == T(0) );
+  REQUIRE( NT::one()  == T(1) );
+
+  REQUIRE( U( NT::max() ) == ( Signed ? ( U(1) << 127 ) - 1 : ~U(0) ) );
+  REQUIRE( U( NT::min() ) == ( Signed ? ( U(1) << 127 ) : U(0) ) );
+  REQUIRE( NT::digits() == ( Signed ? 127u : 128u ) );
+  REQUIRE( NT::isBounded() == DGtal::BOUNDED );
+  REQUIRE( NT::isSigned() == ( Signed ? DGtal::SIGNED : DGtal::UNSIGNED ) );
+
+  REQUIRE( NT::even(T(42)) == true );
+  REQUIRE( NT::even(T(43)) == false );
+  REQUIRE( NT::odd(T(42)) == false );
+  REQUIRE( NT::odd(T(43)) == true );
+  REQUIRE( NT::odd( NT::max() ) == true );
+
+  REQUIRE( NT::castToInt64_t(T(3)) == 3 );
+  REQUIRE( NT::castToDouble( T( U(1) << 100 ) ) == 1267650600228229401496703205376. );
+
+  checkParamRef(NT::ZERO);
+  checkParamRef(NT::ONE);
+}
+
+TEST_CASE( "int128_t" )  { checkInt128Type< DGtal::int128_t,  true >(); }
+TEST_CASE( "uint128_t" ) { checkInt128Type< DGtal::uint128_t, false >(); }
+
+#endif
@@ -0,0 +1,201 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testParallelDomainTraversal.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing the parallel traversals of HyperRectDomain.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <functional>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/domains/ParallelDomainTraversal.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/kernel/sets/DigitalSetInserter.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing the parallel traversals of HyperRectDomain.
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "Parallel traversals of HyperRectDomain", "[parallel][domain]" )
+{
+  Z3i::Domain domain( Z3i::Point( -13, 2, -40 ), Z3i::Point( 49, 37, 3 ) );
+  typedef Z3i::Domain::Size Size;
+  const Size n = domain.size();
+
+  GIVEN( "A whole domain" ) {
+    THEN( "forEach visits each point once, at its linear index" ) {
+      std::vector< Z3i::Point > points( n );
+      std::vector< int > visits( n, 0 );
+      parallel::forEach( domain, [&] ( Size i, const Z3i::Point& p )
+                         { points[ i ] = p; visits[ i ] += 1; } );
+      Size i = 0;
+      for ( auto p : domain )
+        {
+          REQUIRE( points[ i ] == p );
+          REQUIRE( visits[ i ] == 1 );
+          ++i;
+        }
+    }
+    THEN( "Spans are row-aligned and multiples of the granularity" ) {
+      std::vector< int > visits( n, 0 );
+      const Size row = 63;
+      parallel::forEachSpan( domain, [&] ( Size b, Size e, const Z3i::Point& first )
+                             {
+                               #pragma omp critical
+                               {
+                                 REQUIRE( b % row == 0 );
+                                 REQUIRE( b % 64 == 0 );
+                                 REQUIRE( first[ 0 ] == -13 );
+                               }
+                               for ( Size i = b; i < e; ++i ) visits[ i ] += 1;
+                             }, 64 );
+      for ( auto v : visits ) REQUIRE( v == 1 );
+    }
+    THEN( "transform is std::transform, also on std::vector<bool>" ) {
+      std::vector< long > out( n ), expected( n );
+      std::vector< bool > bout( n ), bexpected( n );
+      auto f = [] ( const Z3i::Point& p ) { return long( p[ 0 ] ) * 10000 + p[ 1 ] * 100 + p[ 2 ]; };
+      auto g = [] ( const Z3i::Point& p ) { return ( p[ 0 ] + p[ 1 ] + p[ 2 ] ) % 3 == 0; };
+      parallel::transform( domain, out.begin(), f );
+      parallel::transform( domain, bout.begin(), g );
+      std::transform( domain.begin(), domain.end(), expected.begin(), f );
+      std::transform( domain.begin(), domain.end(), bexpected.begin(), g );
+      REQUIRE( out == expected );
+      REQUIRE( bout == bexpected );
+    }
+    THEN( "reduce and copyIf give the sequential results" ) {
+      auto f = [] ( const Z3i::Point& p ) { return long( p[ 0 ] ) * p[ 1 ] - p[ 2 ]; };
+      long expected = 0;
+      for ( auto p : domain ) expected += f( p );
+      REQUIRE( parallel::reduce( domain, 0L, f, std::plus< long >() ) == expected );
+      auto pred = [] ( const Z3i::Point& p ) { return p.squaredNorm() < 400; };
+      std::vector< Z3i::Point > selected, seq_selected;
+      parallel::copyIf( domain, std::back_inserter( selected ), pred );
+      std::copy_if( domain.begin(), domain.end(), std::back_inserter( seq_selected ), pred );
+      REQUIRE( selected == seq_selected );
+    }
+  }
+
+  GIVEN( "A box within the domain" ) {
+    const Z3i::Point lo( 0, 5, -30 ), hi( 20, 5, 1 );
+    THEN( "forEach and reduce visit the points of the box only" ) {
+      std::vector< int > visits( n, 0 );
+      std::vector< Z3i::Point > points( n, domain.lowerBound() );
+      parallel::forEach( domain, lo, hi, [&] ( Size i, const Z3i::Point& p )
+                         { points[ i ] = p; visits[ i ] += 1; } );
+      Size i = 0, nb = 0;
+      for ( auto p : domain )
+        {
+          const int expected = Z3i::Domain( lo, hi ).isInside( p ) ? 1 : 0;
+          REQUIRE( visits[ i ] == expected );
+          if ( expected ) REQUIRE( points[ i ] == p );
+          ++i;
+          nb += expected;
+        }
+      REQUIRE( parallel::reduce( domain, lo, hi, Size( 0 ),
+                                 [] ( const Z3i::Point& ) { return Size( 1 ); },
+                                 std::plus< Size >() ) == nb );
+    }
+  }
+
+  GIVEN( "Image helpers on images stored in vectors" ) {
+    ImageContainerBySTLVector< Z3i::Domain, int > image( domain );
+    struct Functor {
+      typedef Z3i::Point Point;
+      typedef int        Value;
+      Value operator()( const Point& p ) const { return ( p[ 0 ] * 7 + p[ 1 ] * 3 + p[ 2 ] ) % 11; }
+    } fun;
+    parallel::imageFromFunctor( image, fun );
+    THEN( "Values and thresholded sets are those of the sequential helpers" ) {
+      for ( auto p : domain ) REQUIRE( image( p ) == fun( p ) );
+      Z3i::DigitalSet S( domain ), T( domain );
+      setFromImage( image, DigitalSetInserter< Z3i::DigitalSet >( S ), 2 );
+      setFromImage( image, DigitalSetInserter< Z3i::DigitalSet >( T ), 2, 5 );
+      Size nbS = 0, nbT = 0;
+      for ( auto p : domain )
+        {
+          REQUIRE( S( p ) == ( image( p ) <= 2 ) );
+          REQUIRE( T( p ) == ( ( image( p ) >= 2 ) && ( image( p ) <= 5 ) ) );
+          nbS += S( p ) ? 1 : 0;
+          nbT += T( p ) ? 1 : 0;
+        }
+      REQUIRE( S.size() == nbS );
+      REQUIRE( T.size() == nbT );
+    }
+  }
+
+  GIVEN( "A functor that changes its state" ) {
+    ImageContainerBySTLVector< Z3i::Domain, int > image( domain );
+    // Returns a value of the point, and the number of its former calls.
+    struct StatefulFunctor {
+      typedef Z3i::Point Point;
+      typedef int        Value;
+      int nb;
+      StatefulFunctor() : nb( 0 ) {}
+      Value operator()( const Point& p )
+      {
+        const int k = nb++;
+        return ( p[ 0 ] * 7 + p[ 1 ] * 3 + p[ 2 ] ) % 11 + 16 * k;
+      }
+    } fun;
+    THEN( "imageFromFunctor calls it sequentially, in the domain order" ) {
+      imageFromFunctor( image, fun );
+      int k = 0;
+      for ( auto p : domain )
+        REQUIRE( image( p ) == ( p[ 0 ] * 7 + p[ 1 ] * 3 + p[ 2 ] ) % 11 + 16 * k++ );
+    }
+    THEN( "Each thread of parallel::imageFromFunctor calls its own copy" ) {
+      parallel::imageFromFunctor( image, fun );
+      REQUIRE( fun.nb == 0 );
+      // Calls of a copy are counted without lost updates: the values
+      // of each copy are 0, 1, 2, ... once each.
+      std::vector< int > calls;
+      for ( auto p : domain )
+        {
+          const int v = image( p ) - ( p[ 0 ] * 7 + p[ 1 ] * 3 + p[ 2 ] ) % 11;
+          REQUIRE( v % 16 == 0 );
+          const Size k = Size( v / 16 );
+          if ( calls.size() <= k ) calls.resize( k + 1, 0 );
+          calls[ k ] += 1;
+        }
+      REQUIRE( ! calls.empty() );
+      for ( Size k = 1; k < calls.size(); ++k )
+        REQUIRE( calls[ k ] <= calls[ k - 1 ] );
+      Size total = 0;
+      for ( auto c : calls ) total += Size( c );
+      REQUIRE( total == n );
+    }
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
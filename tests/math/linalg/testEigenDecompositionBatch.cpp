@@ -0,0 +1,158 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testEigenDecompositionBatch.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class EigenDecompositionBatch.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/math/linalg/EigenDecomposition.h"
+#include "DGtal/math/linalg/EigenDecompositionBatch.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class EigenDecompositionBatch.
+///////////////////////////////////////////////////////////////////////////////
+
+/// @return a random symmetric matrix, possibly with repeated eigenvalues.
+template <typename Matrix>
+Matrix randomSymmetricMatrix( unsigned int i )
+{
+  const Dimension n = Matrix::N;
+  Matrix m;
+  for ( Dimension r = 0; r < n; ++r )
+    for ( Dimension c = r; c < n; ++c )
+      {
+        const double x = ( i % 4 == 1 && r != c ) ? 0.0            // diagonal
+          : ( i % 4 == 2 ) ? 1.0                                   // rank 1
+          : 10.0 * rand() / (double) RAND_MAX - 5.0;
+        m.setComponent( r, c, x );
+        m.setComponent( c, r, x );
+      }
+  return m;
+}
+
+/**
+ * Checks that the batch decomposition of random matrices gives the
+ * eigenvalues of EigenDecomposition and orthonormal eigenvectors
+ * that diagonalize the matrices.
+ */
+template <Dimension N>
+void checkBatch( unsigned int nb )
+{
+  typedef EigenDecomposition<N,double>      Eigen;
+  typedef EigenDecompositionBatch<N,double> Batch;
+  typedef typename Batch::Matrix Matrix;
+  typedef typename Batch::Vector Vector;
+  std::vector<Matrix> matrices;
+  Batch batch( nb );
+  for ( unsigned int i = 0; i < nb; ++i )
+    {
+      matrices.push_back( randomSymmetricMatrix<Matrix>( i ) );
+      batch.setMatrix( i, matrices.back() );
+    }
+  batch.compute();
+  double errValues = 0.0, errOrtho = 0.0, errDiag = 0.0, errSingle = 0.0;
+  bool sorted = true;
+  for ( unsigned int i = 0; i < nb; ++i )
+    {
+      Matrix P, Pe, Ps;
+      Vector v, ve, vs;
+      batch.getEigenVectors( i, P );
+      batch.getEigenValues( i, v );
+      Eigen::getEigenDecomposition( matrices[ i ], Pe, ve );
+      Batch::getEigenDecomposition( matrices[ i ], Ps, vs );
+      const Matrix D = P.transpose() * matrices[ i ] * P;
+      const Matrix I = P.transpose() * P;
+      for ( Dimension r = 0; r < N; ++r )
+        {
+          errValues = std::max( errValues, std::abs( v[ r ] - ve[ r ] ) );
+          errSingle = std::max( errSingle, std::abs( v[ r ] - vs[ r ] ) );
+          if ( r + 1 < N ) sorted = sorted && v[ r ] <= v[ r + 1 ];
+          for ( Dimension c = 0; c < N; ++c )
+            {
+              errOrtho  = std::max( errOrtho, std::abs( I( r, c ) - ( r == c ? 1.0 : 0.0 ) ) );
+              errDiag   = std::max( errDiag, std::abs( D( r, c ) - ( r == c ? v[ r ] : 0.0 ) ) );
+              errSingle = std::max( errSingle, std::abs( P( r, c ) - Ps( r, c ) ) );
+            }
+        }
+    }
+  INFO( "dim=" << N << " nb=" << nb << " errValues=" << errValues
+        << " errOrtho=" << errOrtho << " errDiag=" << errDiag );
+  REQUIRE( sorted );
+  REQUIRE( errValues < 1e-10 );
+  REQUIRE( errOrtho < 1e-10 );
+  REQUIRE( errDiag < 1e-10 );
+  // A matrix gives the same result alone or in a batch.
+  REQUIRE( errSingle < 1e-12 );
+}
+
+TEST_CASE( "Testing EigenDecompositionBatch" )
+{
+  srand( 0 );
+  SECTION( "2x2 symmetric matrices" )
+    {
+      checkBatch<2>( 1000 );
+    }
+  SECTION( "3x3 symmetric matrices" )
+    {
+      checkBatch<3>( 1000 );
+    }
+  SECTION( "4x4 symmetric matrices, in a partial block" )
+    {
+      checkBatch<4>( 37 );
+    }
+  SECTION( "Known decomposition and arrays of results" )
+    {
+      // [4 1]
+      // [1 2]
+      EigenDecompositionBatch<2,double> batch( 2 );
+      batch.coefficients( 0, 0 )[ 0 ] = 4.0;
+      batch.coefficients( 0, 1 )[ 0 ] = 1.0;
+      batch.coefficients( 1, 1 )[ 0 ] = 2.0;
+      batch.coefficients( 0, 0 )[ 1 ] = 0.0;
+      batch.coefficients( 1, 0 )[ 1 ] = 0.0;
+      batch.coefficients( 1, 1 )[ 1 ] = 0.0;
+      batch.compute();
+      REQUIRE( std::abs( batch.eigenValues( 0 )[ 0 ] - 1.585786437626905 ) < 1e-12 );
+      REQUIRE( std::abs( batch.eigenValues( 1 )[ 0 ] - 4.414213562373095 ) < 1e-12 );
+      REQUIRE( std::abs( std::abs( batch.eigenVectors( 0, 1 )[ 0 ] ) - 0.9238795325112868 ) < 1e-12 );
+      REQUIRE( std::abs( std::abs( batch.eigenVectors( 1, 1 )[ 0 ] ) - 0.3826834323650898 ) < 1e-12 );
+      REQUIRE( batch.eigenValues( 0 )[ 1 ] == 0.0 );
+      REQUIRE( batch.eigenValues( 1 )[ 1 ] == 0.0 );
+      REQUIRE( batch.eigenVectors( 0, 0 )[ 1 ] == 1.0 );
+      REQUIRE( batch.eigenVectors( 1, 1 )[ 1 ] == 1.0 );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
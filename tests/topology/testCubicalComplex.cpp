@@ -36,6 +36,7 @@
 #include "DGtal/topology/KhalimskySpaceND.h"
 #include "DGtal/topology/KhalimskyCellHashFunctions.h"
 #include "DGtal/topology/CubicalComplex.h"
+#include "DGtal/topology/CubicalCellHashMap.h"
 #include "DGtalCatch.h"
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -618,5 +619,269 @@ SCENARIO( "CubicalComplex< K2,std::map<> > set operations and relations", "[cubi
   bool X1bd_equal_X1boundary = X1bd == X1.boundary();
   REQUIRE( X1bd_equal_X1boundary );
 }
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// CUBICALCELLHASHMAP
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "CubicalCellHashMap< K3 > container tests", "[cubical_complex][hash_map]" )
+{
+  typedef KhalimskySpaceND<3>                         KSpace;
+  typedef KSpace::Point                               Point;
+  typedef KSpace::Cell                                Cell;
+  typedef CubicalCellHashMap< Cell, CubicalCellData > Map;
+  typedef std::map< Cell, uint32_t >                  Reference;
+
+  BOOST_CONCEPT_ASSERT(( boost::ForwardContainer<Map> ));
+  BOOST_CONCEPT_ASSERT(( concepts::CSTLAssociativeContainer<Map> ));
+  REQUIRE( IsPairAssociativeContainer<Map>::value );
+
+  srand( 0 );
+  KSpace K;
+  K.init( Point( 0,0,0 ), Point( 32,32,32 ), true );
+  Map M;
+  Reference R;
+  for ( int n = 0; n < 20000; ++n )
+    {
+      Cell c = K.uCell( Point( rand() % 65, rand() % 65, rand() % 65 ) );
+      if ( rand() % 3 == 0 )
+        REQUIRE( M.erase( c ) == R.erase( c ) );
+      else
+        {
+          const uint32_t d = rand();
+          REQUIRE( M.insert( std::make_pair( c, CubicalCellData( d ) ) ).second
+                   == R.insert( std::make_pair( c, d ) ).second );
+        }
+    }
+  THEN( "It contains the same cells and data as a std::map" ) {
+    REQUIRE( M.isValid() );
+    REQUIRE( M.size() == R.size() );
+    Reference R2;
+    for ( Map::const_iterator it = M.begin(), itE = M.end(); it != itE; ++it )
+      R2[ it->first ] = it->second.data;
+    REQUIRE( R2 == R );
+    Map M2( M );
+    REQUIRE( M2.size() == M.size() );
+    for ( Reference::const_iterator it = R.begin(), itE = R.end(); it != itE; ++it )
+      REQUIRE( M2[ it->first ].data == it->second );
+    REQUIRE( M2.size() == M.size() );
+  }
+  THEN( "Erasing cells leaves the iterators on the other cells valid" ) {
+    std::vector< Map::iterator > its;
+    for ( Map::iterator it = M.begin(), itE = M.end(); it != itE; ++it )
+      its.push_back( it );
+    for ( std::size_t i = 0; i < its.size(); i += 2 )
+      M.erase( its[ i ] );
+    for ( std::size_t i = 1; i < its.size(); i += 2 )
+      REQUIRE( R[ its[ i ]->first ] == its[ i ]->second.data );
+    REQUIRE( M.size() == its.size() / 2 );
+    REQUIRE( M.isValid() );
+    M.clear();
+    REQUIRE( M.empty() );
+    REQUIRE( M.begin() == M.end() );
+  }
+  THEN( "Inserting present cells in a full table does not invalidate iterators" ) {
+    Map F;
+    std::vector< Cell > cells;
+    for ( int x = 0; ( F.capacity() == 0 ) || ( ( F.size() + 1 ) * 8 <= F.capacity() * 7 ); ++x )
+      {
+        cells.push_back( K.uCell( Point( x % 65, x / 65, 0 ) ) );
+        F[ cells.back() ] = CubicalCellData( x );
+      }
+    const Map::size_type capacity = F.capacity();
+    std::vector< Map::iterator > its;
+    for ( Map::iterator it = F.begin(), itE = F.end(); it != itE; ++it )
+      its.push_back( it );
+    for ( std::size_t i = 0; i < cells.size(); ++i )
+      {
+        REQUIRE( ! F.insert( std::make_pair( cells[ i ], CubicalCellData( 0 ) ) ).second );
+        REQUIRE( F[ cells[ i ] ].data == i );
+      }
+    REQUIRE( F.capacity() == capacity );
+    REQUIRE( F.size() == cells.size() );
+    Map::iterator it = F.begin();
+    for ( std::size_t i = 0; i < its.size(); ++i, ++it )
+      REQUIRE( its[ i ] == it );
+  }
+}
+
+SCENARIO( "CubicalComplex< K3,CubicalCellHashMap<> > closure and collapse tests", "[cubical_complex][hash_map][collapse]" )
+{
+  typedef KhalimskySpaceND<3>                         KSpace;
+  typedef KSpace::Point                               Point;
+  typedef KSpace::Cell                                Cell;
+  typedef KSpace::Integer                             Integer;
+  typedef CubicalCellHashMap< Cell, CubicalCellData > Map;
+  typedef CubicalComplex< KSpace, Map >               CC;
+  typedef CubicalComplex< KSpace >                    MapCC;
+  typedef CC::CellMapIterator                         CellMapIterator;
+
+  srand( 0 );
+  KSpace K;
+  K.init( Point( 0,0,0 ), Point( 128,128,128 ), true );
+
+  GIVEN( "Random voxels, more than in a block of the batched closure" ) {
+    CC X( K ), S( K );
+    MapCC mapX( K ), mapS( K );
+    for ( int n = 0; n < 150000; ++n )
+      {
+        Cell c = K.uSpel( Point( rand() % 64, rand() % 64, rand() % 64 ) );
+        X.insertCell( c );
+        mapX.insertCell( c );
+        if ( n % 2 == 0 ) { S.insertCell( c ); mapS.insertCell( c ); }
+      }
+    CC    clX    = ~X;
+    MapCC mapClX = ~mapX;
+    THEN( "Its closure is the same as with std::map" ) {
+      REQUIRE( clX.size() == mapClX.size() );
+      for ( Dimension d = 0; d <= 3; ++d )
+        REQUIRE( clX.nbCells( d ) == mapClX.nbCells( d ) );
+      std::size_t nb_missing = 0;
+      for ( MapCC::Iterator it = mapClX.begin(), itE = mapClX.end(); it != itE; ++it )
+        nb_missing += clX.belongs( *it ) ? 0 : 1;
+      REQUIRE( nb_missing == 0 );
+      REQUIRE( clX.euler() == mapClX.euler() );
+    }
+    THEN( "Closures and stars of subcomplexes are the same as with std::map" ) {
+      CC    clS     = clX.closure( S, true );
+      MapCC mapClS  = mapClX.closure( mapS, true );
+      CC    clS2    = clX.closure( S );
+      CC    stS     = clX.star( S );
+      MapCC mapStS  = mapClX.star( mapS );
+      REQUIRE( clS.size() == mapClS.size() );
+      REQUIRE( clS2 == clS );
+      REQUIRE( stS.size() == mapStS.size() );
+      std::size_t nb_missing = 0;
+      for ( MapCC::Iterator it = mapClS.begin(), itE = mapClS.end(); it != itE; ++it )
+        nb_missing += clS.belongs( *it ) ? 0 : 1;
+      for ( MapCC::Iterator it = mapStS.begin(), itE = mapStS.end(); it != itE; ++it )
+        nb_missing += stS.belongs( *it ) ? 0 : 1;
+      REQUIRE( nb_missing == 0 );
+    }
+  }
+
+  GIVEN( "A closed cubical complex made of 3x3x3 voxels with their incident cells" ) {
+    CC complex( K );
+    std::vector<Cell> S;
+    for ( Integer x = 0; x < 3; ++x )
+      for ( Integer y = 0; y < 3; ++y )
+        for ( Integer z = 0; z < 3; ++z )
+          {
+            S.push_back( K.uSpel( Point( x, y, z ) ) );
+            complex.insertCell( S.back() );
+          }
+    complex.close();
+    REQUIRE( complex.euler() == 1 );
+
+    WHEN( "Fixing two vertices of this big cube and collapsing it" ) {
+      CellMapIterator it1 = complex.findCell( 0, K.uCell( Point( 0, 0, 0 ) ) );
+      CellMapIterator it2 = complex.findCell( 0, K.uCell( Point( 4, 4, 4 ) ) );
+      REQUIRE( it1 != complex.end( 0 ) );
+      REQUIRE( it2 != complex.end( 0 ) );
+      it1->second.data |= CC::FIXED;
+      it2->second.data |= CC::FIXED;
+      CC::DefaultCellMapIteratorPriority P;
+      functions::collapse( complex, S.begin(), S.end(), P, false, true );
+
+      THEN( "It keeps its topology and has only 0-cells and 1-cells" ) {
+        REQUIRE( complex.euler() == 1 );
+        REQUIRE( complex.nbCells( 2 ) == 0 );
+        REQUIRE( complex.nbCells( 3 ) == 0 );
+        REQUIRE( complex.nbCells( 1 ) > 0 );
+      }
+    }
+  }
+}
+
+SCENARIO( "CubicalComplex< K3,CubicalCellHashMap<> > parallel collapse tests", "[cubical_complex][hash_map][collapse]" )
+{
+  typedef KhalimskySpaceND<3>                         KSpace;
+  typedef KSpace::Point                               Point;
+  typedef KSpace::Cell                                Cell;
+  typedef KSpace::Integer                             Integer;
+  typedef CubicalCellHashMap< Cell, CubicalCellData > Map;
+  typedef CubicalComplex< KSpace, Map >               CC;
+  typedef CC::CellMapIterator                         CellMapIterator;
+  typedef functions::CollapsePassStatistics           PassStatistics;
+
+  srand( 0 );
+  KSpace K;
+  K.init( Point( 0,0,0 ), Point( 512,512,512 ), true );
+
+  GIVEN( "A closed cubical complex made of 3x3x3 voxels with two fixed vertices" ) {
+    CC complex( K );
+    std::vector<Cell> S;
+    for ( Integer x = 0; x < 3; ++x )
+      for ( Integer y = 0; y < 3; ++y )
+        for ( Integer z = 0; z < 3; ++z )
+          {
+            S.push_back( K.uSpel( Point( x, y, z ) ) );
+            complex.insertCell( S.back() );
+          }
+    complex.close();
+    const std::size_t nb_cells = complex.size();
+    CellMapIterator it1 = complex.findCell( 0, K.uCell( Point( 0, 0, 0 ) ) );
+    CellMapIterator it2 = complex.findCell( 0, K.uCell( Point( 4, 4, 4 ) ) );
+    it1->second.data |= CC::FIXED;
+    it2->second.data |= CC::FIXED;
+
+    WHEN( "Collapsing it in parallel" ) {
+      CC::DefaultCellMapIteratorPriority P;
+      std::vector< PassStatistics > stats;
+      uint64_t nb_removed = functions::parallelCollapse( complex, S.begin(), S.end(), P,
+                                                         false, true, &stats );
+      uint64_t nb_pairs = 0, nb_conflicts = 0;
+      for ( std::size_t i = 0; i < stats.size(); ++i )
+        {
+          nb_pairs    += stats[ i ].nbPairs;
+          nb_conflicts += stats[ i ].nbConflicts;
+          REQUIRE( stats[ i ].nbExamined >= stats[ i ].nbCandidates );
+        }
+
+      THEN( "It keeps its topology and has only 0-cells and 1-cells" ) {
+        REQUIRE( complex.euler() == 1 );
+        REQUIRE( complex.nbCells( 2 ) == 0 );
+        REQUIRE( complex.nbCells( 3 ) == 0 );
+        REQUIRE( complex.nbCells( 1 ) > 0 );
+      } AND_THEN( "Statistics account for the removed cells and the conflicting pairs" ) {
+        REQUIRE( ! stats.empty() );
+        REQUIRE( 2 * nb_pairs == nb_removed );
+        REQUIRE( complex.size() + nb_removed == nb_cells );
+        REQUIRE( nb_conflicts > 0 );
+      }
+    }
+  }
+
+  GIVEN( "A closed complex made of random voxels" ) {
+    CC X( K );
+    std::vector<Cell> S;
+    for ( int n = 0; n < 4000; ++n )
+      X.insertCell( K.uSpel( Point( rand() % 24, rand() % 24, rand() % 24 ) ) );
+    X.close();
+    for ( CellMapIterator it = X.begin( 3 ), itE = X.end( 3 ); it != itE; ++it )
+      S.push_back( it->first );
+    const int euler = X.euler();
+
+    WHEN( "Collapsing it sequentially or in parallel with small or big rounds" ) {
+      CC X1( X ), X2( X ), X3( X );
+      CC::DefaultCellMapIteratorPriority P;
+      functions::collapse( X1, S.begin(), S.end(), P, false, true );
+      functions::parallelCollapse( X2, S.begin(), S.end(), P, false, true, 0, 8 );
+      functions::parallelCollapse( X3, S.begin(), S.end(), P, false, true );
+
+      THEN( "All collapsed complexes keep the Euler characteristic and have no more 3-cells" ) {
+        REQUIRE( X1.euler() == euler );
+        REQUIRE( X2.euler() == euler );
+        REQUIRE( X3.euler() == euler );
+        REQUIRE( X1.nbCells( 3 ) == 0 );
+        REQUIRE( X2.nbCells( 3 ) == 0 );
+        REQUIRE( X3.nbCells( 3 ) == 0 );
+      }
+    }
+  }
+}
+
 //                                                                           //
 ///////////////////////////////////////////////////////////////////////////////